@@ -0,0 +1,228 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <glad/glad.h>
+
+#include "batcher.h"
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "shader.h"
+
+static const char* shapeVertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = vec4(aPos, 1.0);\n"
+	"}\0";
+
+static const char* orangeFragmentSource = "#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+	"}\0";
+
+static const char* yellowFragmentSource = "#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = vec4(0.9f, 0.9f, 0.1f, 1.0f);\n"
+	"}\0";
+
+// One small triangle per grid cell covering clip space, 9 floats per shape
+static std::vector<float> makeShapes(int shapeCount)
+{
+	int columns = (int)std::ceil(std::sqrt((double)shapeCount));
+	float cell = 2.0f / columns;
+	std::vector<float> positions;
+	positions.reserve(shapeCount * 9);
+
+	for (int i = 0; i < shapeCount; i++)
+	{
+		float x = -1.0f + (i % columns) * cell;
+		float y = -1.0f + (i / columns) * cell;
+		float corners[9] = {
+			x, y, 0.0f,
+			x + cell * 0.8f, y, 0.0f,
+			x + cell * 0.4f, y + cell * 0.8f, 0.0f
+		};
+		positions.insert(positions.end(), corners, corners + 9);
+	}
+	return positions;
+}
+
+struct ModeResult
+{
+	double seconds;
+	int drawCalls;
+	bool persistent;
+	int stalls;
+	RollingStats cpu;
+	RollingStats gpu;
+
+	ModeResult(int frames) : seconds(0.0), drawCalls(0), persistent(false), stalls(0), cpu(frames), gpu(frames) {}
+};
+
+// What main.cpp did per shape: program switch, VAO bind and a draw each
+static void runPerShape(const std::vector<float>& positions, int shapeCount, int frameCount, int warmupFrames, ModeResult& result)
+{
+	unsigned int programs[2] = {
+		createProgram(shapeVertexSource, orangeFragmentSource),
+		createProgram(shapeVertexSource, yellowFragmentSource)
+	};
+	std::vector<unsigned int> VAOs(shapeCount);
+	std::vector<unsigned int> VBOs(shapeCount);
+	glGenVertexArrays(shapeCount, VAOs.data());
+	glGenBuffers(shapeCount, VBOs.data());
+
+	for (int i = 0; i < shapeCount; i++)
+	{
+		glBindVertexArray(VAOs[i]);
+		glBindBuffer(GL_ARRAY_BUFFER, VBOs[i]);
+		glBufferData(GL_ARRAY_BUFFER, 9 * sizeof(float), &positions[i * 9], GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+		glEnableVertexAttribArray(0);
+	}
+	glFinish();
+
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start;
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		// Warm-up frames go through the timer, which leaves them out
+		if (frame == 0)
+		{
+			glFinish();
+			start = std::chrono::steady_clock::now();
+		}
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (int i = 0; i < shapeCount; i++)
+		{
+			glUseProgram(programs[i % 2]);
+			glBindVertexArray(VAOs[i]);
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+		}
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.drawCalls = shapeCount;
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+
+	glDeleteVertexArrays(shapeCount, VAOs.data());
+	glDeleteBuffers(shapeCount, VBOs.data());
+	glDeleteProgram(programs[0]);
+	glDeleteProgram(programs[1]);
+}
+
+// Every shape re-added and streamed each frame, as a dynamic scene would
+static void runBatched(const std::vector<float>& positions, int shapeCount, int frameCount, int warmupFrames, ModeResult& result)
+{
+	unsigned int colors[2] = { packColor(1.0f, 0.5f, 0.2f), packColor(0.9f, 0.9f, 0.1f) };
+	Batcher batcher;
+	if (!batcher.init())
+		return;
+
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start;
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		// Warm-up frames go through the timer, which leaves them out
+		if (frame == 0)
+		{
+			glFinish();
+			start = std::chrono::steady_clock::now();
+		}
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		batcher.begin();
+		for (int i = 0; i < shapeCount; i++)
+			batcher.addTriangle(&positions[i * 9], colors[i % 2]);
+		batcher.flush();
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.drawCalls = batcher.drawCalls();
+	result.persistent = batcher.streamBuffer().persistent();
+	result.stalls = batcher.streamBuffer().stalls();
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+	batcher.destroy();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int shapeCount = 100000;
+	int frameCount = 30;
+	int warmupFrames = 3;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--shapes") == 0 && i + 1 < argc)
+			shapeCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--shapes N] [--frames N] [--warmup N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (shapeCount <= 0 || frameCount <= 0 || warmupFrames < 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	std::vector<float> positions = makeShapes(shapeCount);
+	ModeResult perShape(frameCount);
+	ModeResult batched(frameCount);
+	runPerShape(positions, shapeCount, frameCount, warmupFrames, perShape);
+	runBatched(positions, shapeCount, frameCount, warmupFrames, batched);
+
+	BenchResults results("bench_batch");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("shapes", shapeCount);
+	results.add("frames", frameCount);
+	results.add("per_shape_draw_calls", perShape.drawCalls);
+	results.add("per_shape_fps", frameCount / perShape.seconds);
+	results.addStats("per_shape_cpu_ms", perShape.cpu);
+	results.addStats("per_shape_gpu_ms", perShape.gpu);
+	results.add("batched_draw_calls", batched.drawCalls);
+	results.add("batched_fps", frameCount / batched.seconds);
+	results.add("batched_stream", batched.persistent ? "persistent" : "orphan");
+	results.add("batched_stream_stalls", batched.stalls);
+	results.addStats("batched_cpu_ms", batched.cpu);
+	results.addStats("batched_gpu_ms", batched.gpu);
+
+	destroyHeadlessContext(headless);
+	return results.write(jsonPath) ? 0 : -1;
+}
@@ -0,0 +1,27 @@
+#include "bench_context.h"
+
+#include <iostream>
+#include <glad/glad.h>
+
+bool createBenchContext(HeadlessContext& headless, int width, int height)
+{
+	if (!createHeadlessContext(headless, width, height))
+		return false;
+
+	if (!gladLoadGLLoader((GLADloadproc)headlessGetProcAddress))
+	{
+		std::cout << "ERROR::BENCH::GL_LOAD_FAILED" << std::endl;
+		destroyHeadlessContext(headless);
+		return false;
+	}
+
+	if (!createHeadlessTarget(headless))
+	{
+		destroyHeadlessContext(headless);
+		return false;
+	}
+
+	glViewport(0, 0, width, height);
+	std::cerr << "Renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+	return true;
+}
@@ -0,0 +1,10 @@
+#ifndef BENCH_CONTEXT_H
+#define BENCH_CONTEXT_H
+
+#include "headless.h"
+
+// Headless context with GL loaded and the offscreen target bound and sized,
+// ready to draw into. Prints the renderer, returns false on any failure.
+bool createBenchContext(HeadlessContext& headless, int width, int height);
+
+#endif
@@ -0,0 +1,159 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <glad/glad.h>
+
+#include "batcher.h"
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "indirect.h"
+
+// A few small meshes so consecutive draws really use different geometry
+static IndexedMesh makePolygon(int sides)
+{
+	std::vector<float> triangles;
+	const float pi = 3.14159265f;
+	for (int i = 0; i < sides; i++)
+	{
+		float a0 = 2.0f * pi * i / sides;
+		float a1 = 2.0f * pi * (i + 1) / sides;
+		float corners[9] = { 0.0f, 0.0f, 0.0f, cosf(a0), sinf(a0), 0.0f, cosf(a1), sinf(a1), 0.0f };
+		triangles.insert(triangles.end(), corners, corners + 9);
+	}
+	return buildIndexedMesh(triangles.data(), triangles.size() / 3, 3);
+}
+
+struct ModeResult
+{
+	bool supported;
+	double seconds;
+	int visible;
+	RollingStats cpu;
+	RollingStats gpu;
+
+	ModeResult(int frames) : supported(false), seconds(0.0), visible(0), cpu(frames), gpu(frames) {}
+};
+
+// Objects on a grid that overhangs clip space on every side, so a bit over
+// half of them are culled
+static void runMode(IndirectMode mode, int objectCount, int frameCount, int warmupFrames, ModeResult& result)
+{
+	IndirectRenderer renderer;
+	int meshes[3] = { renderer.addMesh(makePolygon(3)), renderer.addMesh(makePolygon(4)), renderer.addMesh(makePolygon(6)) };
+	if (!renderer.init(mode) || renderer.mode() != mode)
+	{
+		renderer.destroy();
+		return;
+	}
+	result.supported = true;
+
+	int columns = (int)std::ceil(std::sqrt((double)objectCount));
+	float cell = 3.0f / columns;
+	unsigned int colors[2] = { packColor(1.0f, 0.5f, 0.2f), packColor(0.9f, 0.9f, 0.1f) };
+
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start;
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		// Warm-up frames go through the timer, which leaves them out
+		if (frame == 0)
+		{
+			glFinish();
+			start = std::chrono::steady_clock::now();
+		}
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		renderer.begin();
+		for (int i = 0; i < objectCount; i++)
+		{
+			float x = -1.5f + (i % columns + 0.5f) * cell;
+			float y = -1.5f + (i / columns + 0.5f) * cell;
+			renderer.add(meshes[i % 3], makeInstance(x, y, cell * 0.4f, cell * 0.4f, colors[i % 2]));
+		}
+		renderer.flush();
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.visible = renderer.visibleCount();
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+	renderer.destroy();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int objectCount = 100000;
+	int frameCount = 30;
+	int warmupFrames = 3;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+			objectCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--objects N] [--frames N] [--warmup N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (objectCount <= 0 || frameCount <= 0 || warmupFrames < 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	BenchResults results("bench_indirect");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("objects", objectCount);
+	results.add("frames", frameCount);
+
+	// Modes the context can't do are reported as unsupported rather than
+	// silently measuring their fallback
+	IndirectMode modes[3] = { INDIRECT_CPU_LOOP, INDIRECT_MULTI_DRAW, INDIRECT_GPU_CULL };
+	for (int m = 0; m < 3; m++)
+	{
+		ModeResult result(frameCount);
+		runMode(modes[m], objectCount, frameCount, warmupFrames, result);
+
+		std::string prefix = IndirectRenderer::modeName(modes[m]);
+		for (size_t c = 0; c < prefix.size(); c++)
+			if (prefix[c] == '-')
+				prefix[c] = '_';
+
+		results.add((prefix + "_supported").c_str(), result.supported ? 1.0 : 0.0);
+		if (!result.supported)
+			continue;
+		results.add((prefix + "_visible").c_str(), result.visible);
+		results.add((prefix + "_fps").c_str(), frameCount / result.seconds);
+		results.addStats((prefix + "_cpu_ms").c_str(), result.cpu);
+		results.addStats((prefix + "_gpu_ms").c_str(), result.gpu);
+	}
+
+	destroyHeadlessContext(headless);
+	return results.write(jsonPath) ? 0 : -1;
+}
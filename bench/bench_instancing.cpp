@@ -0,0 +1,188 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <glad/glad.h>
+
+#include "batcher.h"
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "instancing.h"
+
+// Marker quad around the origin, scaled per instance
+static const float markerPositions[] = {
+	-0.5f, -0.5f, 0.0f,
+	0.5f, -0.5f, 0.0f,
+	0.5f, 0.5f, 0.0f,
+	-0.5f, 0.5f, 0.0f
+};
+static const unsigned int markerIndices[] = {
+	0, 1, 2,
+	0, 2, 3
+};
+
+struct ModeResult
+{
+	double seconds;
+	double bytesPerFrame;
+	RollingStats cpu;
+	RollingStats gpu;
+
+	ModeResult(int frames) : seconds(0.0), bytesPerFrame(0.0), cpu(frames), gpu(frames) {}
+};
+
+// Markers on a grid covering clip space, each a fraction of its cell
+struct MarkerGrid
+{
+	int columns;
+	float cell;
+
+	MarkerGrid(int markerCount) : columns((int)std::ceil(std::sqrt((double)markerCount))), cell(2.0f / columns) {}
+
+	float x(int i) const { return -1.0f + (i % columns + 0.5f) * cell; }
+	float y(int i) const { return -1.0f + (i / columns + 0.5f) * cell; }
+	float size() const { return cell * 0.7f; }
+};
+
+static unsigned int markerColor(int i)
+{
+	return i % 2 == 0 ? packColor(1.0f, 0.5f, 0.2f) : packColor(0.9f, 0.9f, 0.1f);
+}
+
+static void runBatched(int markerCount, int frameCount, int warmupFrames, ModeResult& result)
+{
+	MarkerGrid grid(markerCount);
+	Batcher batcher;
+	if (!batcher.init())
+		return;
+
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start;
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		// Warm-up frames go through the timer, which leaves them out
+		if (frame == 0)
+		{
+			glFinish();
+			start = std::chrono::steady_clock::now();
+		}
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		batcher.begin();
+		for (int i = 0; i < markerCount; i++)
+		{
+			float size = grid.size();
+			batcher.addQuad(grid.x(i) - size * 0.5f, grid.y(i) - size * 0.5f, size, size, markerColor(i));
+		}
+		batcher.flush();
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.bytesPerFrame = (double)batcher.vertexCount() * sizeof(Batcher::Vertex);
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+	batcher.destroy();
+}
+
+static void runInstanced(int markerCount, int frameCount, int warmupFrames, ModeResult& result)
+{
+	MarkerGrid grid(markerCount);
+	InstancedMesh mesh;
+	if (!mesh.init(markerPositions, 4, markerIndices, 6))
+		return;
+
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start;
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		// Warm-up frames go through the timer, which leaves them out
+		if (frame == 0)
+		{
+			glFinish();
+			start = std::chrono::steady_clock::now();
+		}
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		mesh.begin();
+		for (int i = 0; i < markerCount; i++)
+			mesh.add(makeInstance(grid.x(i), grid.y(i), grid.size(), grid.size(), markerColor(i)));
+		mesh.flush();
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.bytesPerFrame = (double)mesh.instanceCount() * sizeof(Instance);
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+	mesh.destroy();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 1920;
+	int height = 1080;
+	int markerCount = 1000000;
+	int frameCount = 30;
+	int warmupFrames = 3;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--markers") == 0 && i + 1 < argc)
+			markerCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--markers N] [--frames N] [--warmup N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (markerCount <= 0 || frameCount <= 0 || warmupFrames < 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	ModeResult batched(frameCount);
+	ModeResult instanced(frameCount);
+	runBatched(markerCount, frameCount, warmupFrames, batched);
+	runInstanced(markerCount, frameCount, warmupFrames, instanced);
+
+	BenchResults results("bench_instancing");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("markers", markerCount);
+	results.add("frames", frameCount);
+	results.add("batched_upload_bytes", batched.bytesPerFrame);
+	results.add("batched_fps", frameCount / batched.seconds);
+	results.addStats("batched_cpu_ms", batched.cpu);
+	results.addStats("batched_gpu_ms", batched.gpu);
+	results.add("instanced_upload_bytes", instanced.bytesPerFrame);
+	results.add("instanced_fps", frameCount / instanced.seconds);
+	results.addStats("instanced_cpu_ms", instanced.cpu);
+	results.addStats("instanced_gpu_ms", instanced.gpu);
+
+	destroyHeadlessContext(headless);
+	return results.write(jsonPath) ? 0 : -1;
+}
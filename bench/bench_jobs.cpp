@@ -0,0 +1,320 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "job_system.h"
+#include "program_reflection.h"
+#include "render_queue.h"
+#include "shader.h"
+
+static const char* vertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"uniform vec4 placement;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = vec4(aPos.xy * placement.z + placement.xy, aPos.z, 1.0);\n"
+	"}\0";
+
+static const char* fragmentSource = "#version 330 core\n"
+	"uniform vec4 tint;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = tint;\n"
+	"}\0";
+
+static const float triangle[] = {
+	-0.5f, -0.5f, 0.0f,
+	0.5f, -0.5f, 0.0f,
+	0.0f, 0.5f, 0.0f
+};
+
+static const unsigned int PLACEMENT = shaderName("placement");
+static const unsigned int TINT = shaderName("tint");
+
+// Objects drift through a world twice the size of the view
+struct Object
+{
+	float x, y;
+	float vx, vy;
+	float radius;
+	unsigned int material;
+	unsigned int vertexArray;
+};
+
+// What one worker records: draws and, per draw, placement and tint
+struct CommandBuffer
+{
+	RenderQueue queue;
+	std::vector<float> uniforms;
+
+	// Sorted inside a job, where the worker itself is the one thread to use
+	CommandBuffer() : queue(1) {}
+};
+
+struct FrameWork
+{
+	std::vector<Object>* objects;
+	std::vector<CommandBuffer>* buffers;
+	const std::vector<unsigned int>* vertexArrays;
+	unsigned int program;
+	float dt;
+};
+
+// A draw's uniforms: worker in the top byte, draw in that worker's buffer below
+static unsigned int uniformSlot(int worker, size_t draw)
+{
+	return ((unsigned int)worker << 24) | (unsigned int)draw;
+}
+
+static float wrap(float value)
+{
+	return value > 2.0f ? value - 4.0f : value < -2.0f ? value + 4.0f : value;
+}
+
+// Animate, cull and record a range of objects into the running worker's buffer
+static void recordObjects(void* data, int begin, int end, int worker)
+{
+	FrameWork& work = *(FrameWork*)data;
+	CommandBuffer& buffer = (*work.buffers)[worker];
+	for (int i = begin; i < end; i++)
+	{
+		Object& object = (*work.objects)[i];
+		object.x = wrap(object.x + object.vx * work.dt);
+		object.y = wrap(object.y + object.vy * work.dt);
+		if (object.x + object.radius < -1.0f || object.x - object.radius > 1.0f
+			|| object.y + object.radius < -1.0f || object.y - object.radius > 1.0f)
+			continue;
+
+		size_t draw = buffer.uniforms.size() / 8;
+		float uniforms[8] = {
+			object.x, object.y, object.radius * 2.0f, 0.0f,
+			(object.material % 7) / 7.0f, (object.material % 5) / 5.0f, (object.material % 3) / 3.0f, 1.0f
+		};
+		buffer.uniforms.insert(buffer.uniforms.end(), uniforms, uniforms + 8);
+
+		unsigned int vertexArray = (*work.vertexArrays)[object.vertexArray];
+		DrawItem item = makeArraysDraw(work.program, vertexArray, GL_TRIANGLES, 0, 3);
+		item.material = uniformSlot(worker, draw);
+		buffer.queue.add(makeSortKey(0, work.program, object.material, object.vertexArray, (object.y + 2.0f) / 4.0f), item);
+	}
+}
+
+// Each buffer is sorted by whichever worker picks its job up
+static void sortBuffers(void* data, int begin, int end, int)
+{
+	FrameWork& work = *(FrameWork*)data;
+	for (int i = begin; i < end; i++)
+		(*work.buffers)[i].queue.sort();
+}
+
+struct UniformSource
+{
+	ProgramReflection* reflection;
+	const std::vector<CommandBuffer>* buffers;
+};
+
+static void bindUniforms(unsigned int material, void* user)
+{
+	UniformSource& source = *(UniformSource*)user;
+	const float* uniforms = &(*source.buffers)[material >> 24].uniforms[(material & 0xFFFFFF) * 8];
+	source.reflection->setVec4(PLACEMENT, uniforms);
+	source.reflection->setVec4(TINT, uniforms + 4);
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int objectCount = 200000;
+	int frameCount = 20;
+	int grain = 1024;
+	int maxWorkers = (int)std::thread::hardware_concurrency();
+	bool submit = false;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+			objectCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--grain") == 0 && i + 1 < argc)
+			grain = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--max-workers") == 0 && i + 1 < argc)
+			maxWorkers = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--submit") == 0)
+			submit = true;
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--objects N] [--frames N] [--grain N]"
+				<< " [--max-workers N] [--submit] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (maxWorkers <= 0)
+		maxWorkers = 1;
+	if (objectCount <= 0 || frameCount <= 0 || grain <= 0 || maxWorkers > 255)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+
+	unsigned int program = createProgram(vertexSource, fragmentSource);
+	ProgramReflection reflection;
+	if (program == 0 || !reflection.reflect(program))
+	{
+		destroyHeadlessContext(headless);
+		return -1;
+	}
+
+	// Every vertex array holds the same triangle, they only matter for sorting
+	const int vertexArrayCount = 64;
+	std::vector<unsigned int> vertexArrays(vertexArrayCount);
+	unsigned int vbo;
+	glGenBuffers(1, &vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glGenVertexArrays(vertexArrayCount, &vertexArrays[0]);
+	for (int i = 0; i < vertexArrayCount; i++)
+	{
+		glBindVertexArray(vertexArrays[i]);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+		glEnableVertexAttribArray(0);
+	}
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> velocity(-0.5f, 0.5f);
+	std::vector<Object> initial(objectCount);
+	for (int i = 0; i < objectCount; i++)
+	{
+		initial[i].x = position(random);
+		initial[i].y = position(random);
+		initial[i].vx = velocity(random);
+		initial[i].vy = velocity(random);
+		initial[i].radius = 0.002f + (random() % 100) / 10000.0f;
+		initial[i].material = random() % 256;
+		initial[i].vertexArray = random() % vertexArrayCount;
+	}
+
+	BenchResults results("bench_jobs");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("hardware_threads", (double)std::thread::hardware_concurrency());
+	results.add("objects", objectCount);
+	results.add("frames", frameCount);
+	results.add("grain", grain);
+	results.add("submit", submit ? 1.0 : 0.0);
+
+	// 1, 2, 4, ... workers, and the maximum itself
+	std::vector<int> workerCounts;
+	for (int workers = 1; workers < maxWorkers; workers *= 2)
+		workerCounts.push_back(workers);
+	workerCounts.push_back(maxWorkers);
+
+	double singleWorkerMs = 0.0;
+	size_t visible = 0;
+	for (size_t w = 0; w < workerCounts.size(); w++)
+	{
+		int workers = workerCounts[w];
+		JobSystem jobs(workers);
+		std::vector<Object> objects = initial;
+		std::vector<CommandBuffer> buffers(workers);
+		RenderQueue merged(1);
+		UniformSource uniformSource = { &reflection, &buffers };
+		merged.setMaterialBinder(bindUniforms, &uniformSource);
+
+		FrameWork work;
+		work.objects = &objects;
+		work.buffers = &buffers;
+		work.vertexArrays = &vertexArrays;
+		work.program = program;
+		work.dt = 0.016f;
+
+		RollingStats prepare(frameCount);
+		RollingStats merge(frameCount);
+		RollingStats submission(frameCount);
+		int steals = jobs.steals();
+
+		// One extra frame up front warms caches and sizes the buffers
+		for (int frame = -1; frame < frameCount; frame++)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for (int i = 0; i < workers; i++)
+			{
+				buffers[i].queue.begin();
+				buffers[i].uniforms.clear();
+			}
+			jobs.parallelFor(objectCount, grain, recordObjects, &work);
+			jobs.parallelFor(workers, 1, sortBuffers, &work);
+			double prepareMs = millisecondsSince(start);
+
+			// Only the merge and the GL calls stay on this thread
+			start = std::chrono::steady_clock::now();
+			std::vector<const RenderQueue*> sorted;
+			for (int i = 0; i < workers; i++)
+				sorted.push_back(&buffers[i].queue);
+			merged.merge(sorted);
+			double mergeMs = millisecondsSince(start);
+
+			start = std::chrono::steady_clock::now();
+			if (submit)
+			{
+				glClear(GL_COLOR_BUFFER_BIT);
+				merged.submit();
+				glFinish();
+			}
+			double submitMs = millisecondsSince(start);
+
+			if (frame < 0)
+				continue;
+			prepare.add(prepareMs);
+			merge.add(mergeMs);
+			submission.add(submitMs);
+			visible = merged.size();
+		}
+
+		std::string prefix = "workers_" + std::to_string(workers);
+		results.addStats((prefix + "_prepare_ms").c_str(), prepare);
+		results.addStats((prefix + "_merge_ms").c_str(), merge);
+		if (submit)
+			results.addStats((prefix + "_submit_ms").c_str(), submission);
+		results.add((prefix + "_steals_per_frame").c_str(), (double)(jobs.steals() - steals) / (frameCount + 1));
+		if (workers == 1)
+			singleWorkerMs = prepare.percentile(0.5);
+		else
+			results.add((prefix + "_prepare_speedup").c_str(), singleWorkerMs / prepare.percentile(0.5));
+	}
+	results.add("visible_draws", (double)visible);
+
+	results.write(jsonPath);
+
+	glDeleteVertexArrays(vertexArrayCount, &vertexArrays[0]);
+	glDeleteBuffers(1, &vbo);
+	glDeleteProgram(program);
+	destroyHeadlessContext(headless);
+	return 0;
+}
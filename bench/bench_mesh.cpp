@@ -0,0 +1,203 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <glad/glad.h>
+
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "mesh.h"
+#include "shader.h"
+
+static const char* meshVertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"out float shade;\n"
+	"void main()\n"
+	"{\n"
+	"	shade = 0.5 + 0.5 * aPos.z;\n"
+	"	gl_Position = vec4(aPos * 0.9, 1.0);\n"
+	"}\0";
+
+static const char* meshFragmentSource = "#version 330 core\n"
+	"in float shade;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f) * shade;\n"
+	"}\0";
+
+// Unit sphere as a triangle list in scrambled order, which is roughly what
+// an exporter that doesn't care about vertex caches hands over
+static std::vector<float> makeSphereTriangles(int rings, int segments)
+{
+	const float pi = 3.14159265f;
+	std::vector<float> grid;
+	for (int r = 0; r <= rings; r++)
+	{
+		float theta = pi * r / rings;
+		for (int s = 0; s <= segments; s++)
+		{
+			float phi = 2.0f * pi * (s % segments) / segments;
+			grid.push_back(sinf(theta) * cosf(phi));
+			grid.push_back(cosf(theta));
+			grid.push_back(sinf(theta) * sinf(phi));
+		}
+	}
+
+	std::vector<int> quads(rings * segments);
+	for (size_t i = 0; i < quads.size(); i++)
+		quads[i] = (int)i;
+	std::shuffle(quads.begin(), quads.end(), std::mt19937(1234));
+
+	std::vector<float> triangles;
+	for (size_t i = 0; i < quads.size(); i++)
+	{
+		int r = quads[i] / segments;
+		int s = quads[i] % segments;
+		int a = r * (segments + 1) + s;
+		int b = a + segments + 1;
+		int corners[6] = { a, b, a + 1, a + 1, b, b + 1 };
+		for (int k = 0; k < 6; k++)
+			triangles.insert(triangles.end(), &grid[corners[k] * 3], &grid[corners[k] * 3] + 3);
+	}
+	return triangles;
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static RollingStats timeDraws(const IndexedMesh& mesh, unsigned int program, int frameCount, int warmupFrames)
+{
+	GpuMesh gpuMesh;
+	uploadMesh(mesh, gpuMesh);
+	glUseProgram(program);
+
+	// Warm-up frames go through the timer, which leaves them out
+	FrameTimer frameTimer(4, frameCount, warmupFrames);
+	frameTimer.init();
+	for (int frame = -warmupFrames; frame < frameCount; frame++)
+	{
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		drawMesh(gpuMesh);
+		frameTimer.endFrame();
+	}
+	frameTimer.finish();
+	RollingStats gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+	destroyMesh(gpuMesh);
+	return gpu;
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int rings = 256;
+	int segments = 512;
+	int frameCount = 50;
+	int warmupFrames = 3;
+	const char* objPath = NULL;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--sphere") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &rings, &segments);
+		else if (strcmp(argv[i], "--obj") == 0 && i + 1 < argc)
+			objPath = argv[++i];
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--sphere RINGSxSEGMENTS] [--obj FILE]"
+				<< " [--frames N] [--warmup N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (rings <= 0 || segments <= 0 || frameCount <= 0 || warmupFrames < 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	std::vector<float> triangles;
+	if (objPath != NULL)
+	{
+		if (!loadObjTriangles(objPath, triangles))
+			return -1;
+	}
+	else
+		triangles = makeSphereTriangles(rings, segments);
+
+	// Each stage timed separately, ACMR measured with 16 and 32 entry caches
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	IndexedMesh mesh = buildIndexedMesh(triangles.data(), triangles.size() / 3, 3);
+	double indexMs = millisecondsSince(start);
+	IndexedMesh original = mesh;
+	double acmrBefore = computeACMR(mesh.indices, mesh.vertexCount());
+	double acmrBefore32 = computeACMR(mesh.indices, mesh.vertexCount(), 32);
+
+	start = std::chrono::steady_clock::now();
+	optimizeVertexCache(mesh.indices, mesh.vertexCount());
+	double cacheMs = millisecondsSince(start);
+	double acmrCache = computeACMR(mesh.indices, mesh.vertexCount());
+
+	start = std::chrono::steady_clock::now();
+	optimizeOverdraw(mesh);
+	double overdrawMs = millisecondsSince(start);
+
+	start = std::chrono::steady_clock::now();
+	optimizeVertexFetch(mesh);
+	double fetchMs = millisecondsSince(start);
+	double acmrAfter = computeACMR(mesh.indices, mesh.vertexCount());
+	double acmrAfter32 = computeACMR(mesh.indices, mesh.vertexCount(), 32);
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	unsigned int program = createProgram(meshVertexSource, meshFragmentSource);
+	RollingStats gpuBefore = timeDraws(original, program, frameCount, warmupFrames);
+	RollingStats gpuAfter = timeDraws(mesh, program, frameCount, warmupFrames);
+	glDeleteProgram(program);
+
+	BenchResults results("bench_mesh");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("source", objPath != NULL ? objPath : "scrambled sphere");
+	results.add("input_vertices", triangles.size() / 3);
+	results.add("unique_vertices", mesh.vertexCount());
+	results.add("triangles", mesh.triangleCount());
+	results.add("index_bits", mesh.vertexCount() <= 65536 ? 16 : 32);
+	results.add("index_ms", indexMs);
+	results.add("cache_ms", cacheMs);
+	results.add("overdraw_ms", overdrawMs);
+	results.add("fetch_ms", fetchMs);
+	results.add("acmr_before", acmrBefore);
+	results.add("acmr_before_32", acmrBefore32);
+	results.add("acmr_cache_optimized", acmrCache);
+	results.add("acmr_after", acmrAfter);
+	results.add("acmr_after_32", acmrAfter32);
+	results.add("shaded_vertices_before", acmrBefore * mesh.triangleCount());
+	results.add("shaded_vertices_after", acmrAfter * mesh.triangleCount());
+	results.addStats("gpu_ms_before", gpuBefore);
+	results.addStats("gpu_ms_after", gpuAfter);
+
+	destroyHeadlessContext(headless);
+	return results.write(jsonPath) ? 0 : -1;
+}
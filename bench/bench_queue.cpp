@@ -0,0 +1,301 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "render_queue.h"
+#include "shader.h"
+
+static const char* vertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = vec4(aPos, 1.0);\n"
+	"}\0";
+
+// Draws as a scene graph walk would hand them over: objects in no useful
+// state order
+struct Draw
+{
+	unsigned int program;
+	unsigned int material;
+	unsigned int vertexArray;
+	int triangle;
+	float depth;
+};
+
+static std::vector<Draw> makeDraws(int drawCount, int programs, int materials, int vertexArrays, int trianglesPerArray)
+{
+	std::mt19937 random(1234);
+	std::vector<Draw> draws(drawCount);
+	for (int i = 0; i < drawCount; i++)
+	{
+		draws[i].program = random() % programs;
+		draws[i].material = random() % materials;
+		draws[i].vertexArray = random() % vertexArrays;
+		draws[i].triangle = random() % trianglesPerArray;
+		draws[i].depth = (random() % 65536) / 65536.0f;
+	}
+	return draws;
+}
+
+// Program and vertex array ids index these; 0-based ids become GL names
+static void fillQueue(RenderQueue& queue, const std::vector<Draw>& draws,
+	const std::vector<unsigned int>& programs, const std::vector<unsigned int>& vertexArrays)
+{
+	queue.begin();
+	for (size_t i = 0; i < draws.size(); i++)
+	{
+		const Draw& draw = draws[i];
+		unsigned int program = programs.empty() ? draw.program + 1 : programs[draw.program];
+		unsigned int vertexArray = vertexArrays.empty() ? draw.vertexArray + 1 : vertexArrays[draw.vertexArray];
+		DrawItem item = makeArraysDraw(program, vertexArray, GL_TRIANGLES, draw.triangle * 3, 3);
+		item.material = draw.material;
+		queue.add(makeSortKey(0, draw.program, draw.material, draw.vertexArray, draw.depth), item);
+	}
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Stand-in for binding a material's uniforms
+static void bindMaterial(unsigned int material, void* user)
+{
+	(*(unsigned int*)user) += material;
+}
+
+// Sort cost alone, no GL: the same queue refilled and sorted repeatedly
+static RollingStats timeSort(const std::vector<Draw>& draws, int threads, int repeats, QueueStats& sorted)
+{
+	std::vector<unsigned int> none;
+	unsigned int materialSum = 0;
+	RenderQueue queue(threads);
+	queue.setMaterialBinder(bindMaterial, &materialSum);
+	RollingStats stats(repeats);
+
+	for (int i = 0; i < repeats; i++)
+	{
+		fillQueue(queue, draws, none, none);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		queue.sort();
+		stats.add(millisecondsSince(start));
+	}
+	sorted = queue.countSwitches();
+	return stats;
+}
+
+// Reference: std::sort over the bare keys
+static RollingStats timeStdSort(const std::vector<Draw>& draws, int repeats)
+{
+	RollingStats stats(repeats);
+	std::vector<unsigned long long> keys(draws.size());
+	for (int i = 0; i < repeats; i++)
+	{
+		for (size_t j = 0; j < draws.size(); j++)
+			keys[j] = makeSortKey(0, draws[j].program, draws[j].material, draws[j].vertexArray, draws[j].depth);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::sort(keys.begin(), keys.end());
+		stats.add(millisecondsSince(start));
+	}
+	return stats;
+}
+
+struct SubmitResult
+{
+	double seconds;
+	QueueStats switches;
+	RollingStats cpu;
+	RollingStats gpu;
+
+	SubmitResult(int frames) : seconds(0.0), cpu(frames), gpu(frames)
+	{
+		memset(&switches, 0, sizeof(switches));
+	}
+};
+
+// Real submission of a smaller queue, in arrival order or sorted each frame
+static void runSubmit(RenderQueue& queue, const std::vector<Draw>& draws, const std::vector<unsigned int>& programs,
+	const std::vector<unsigned int>& vertexArrays, bool sorted, int frameCount, SubmitResult& result)
+{
+	FrameTimer frameTimer(4, frameCount);
+	frameTimer.init();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frameCount; frame++)
+	{
+		frameTimer.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT);
+		fillQueue(queue, draws, programs, vertexArrays);
+		if (sorted)
+			queue.sort();
+		queue.submit();
+		frameTimer.endFrame();
+	}
+	glFinish();
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.switches = queue.stats();
+	frameTimer.finish();
+	result.cpu = frameTimer.cpuTimes();
+	result.gpu = frameTimer.gpuTimes();
+	frameTimer.destroy();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int sortItems = 1000000;
+	int drawCount = 20000;
+	int frameCount = 20;
+	int repeats = 10;
+	int programCount = 16;
+	int materialCount = 64;
+	int vertexArrayCount = 256;
+	int threads = (int)std::thread::hardware_concurrency();
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--items") == 0 && i + 1 < argc)
+			sortItems = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--draws") == 0 && i + 1 < argc)
+			drawCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc)
+			repeats = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--programs") == 0 && i + 1 < argc)
+			programCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+			threads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--items N] [--draws N] [--frames N]"
+				<< " [--repeats N] [--programs N] [--threads N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (sortItems <= 0 || drawCount <= 0 || frameCount <= 0 || repeats <= 0 || programCount <= 0 || threads <= 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	// Sorting a full-size queue, single threaded and split across threads
+	const int trianglesPerArray = 64;
+	std::vector<Draw> sortDraws = makeDraws(sortItems, programCount, materialCount, vertexArrayCount, trianglesPerArray);
+	QueueStats unsortedSwitches;
+	{
+		std::vector<unsigned int> none;
+		unsigned int materialSum = 0;
+		RenderQueue queue;
+		queue.setMaterialBinder(bindMaterial, &materialSum);
+		fillQueue(queue, sortDraws, none, none);
+		unsortedSwitches = queue.countSwitches();
+	}
+	QueueStats sortedSwitches;
+	RollingStats singleSort = timeSort(sortDraws, 1, repeats, sortedSwitches);
+	RollingStats parallelSort = timeSort(sortDraws, threads, repeats, sortedSwitches);
+	RollingStats stdSort = timeStdSort(sortDraws, repeats);
+
+	// Submitting a queue the software rasteriser can draw at interactive rates
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	std::vector<unsigned int> programs(programCount);
+	for (int i = 0; i < programCount; i++)
+	{
+		char fragmentSource[256];
+		snprintf(fragmentSource, sizeof(fragmentSource), "#version 330 core\n"
+			"out vec4 FragColor;\n"
+			"void main()\n"
+			"{\n"
+			"	FragColor = vec4(%f, 0.5, 0.2, 1.0);\n"
+			"}\n", (float)i / programCount);
+		programs[i] = createProgram(vertexSource, fragmentSource);
+	}
+
+	// Each vertex array holds a row of small triangles, draws pick one
+	std::vector<unsigned int> vertexArrays(vertexArrayCount);
+	std::vector<unsigned int> buffers(vertexArrayCount);
+	glGenVertexArrays(vertexArrayCount, vertexArrays.data());
+	glGenBuffers(vertexArrayCount, buffers.data());
+	for (int i = 0; i < vertexArrayCount; i++)
+	{
+		std::vector<float> positions;
+		float y = -1.0f + 2.0f * i / vertexArrayCount;
+		for (int t = 0; t < trianglesPerArray; t++)
+		{
+			float x = -1.0f + 2.0f * t / trianglesPerArray;
+			float corners[9] = { x, y, 0.0f, x + 0.02f, y, 0.0f, x, y + 0.02f, 0.0f };
+			positions.insert(positions.end(), corners, corners + 9);
+		}
+		glBindVertexArray(vertexArrays[i]);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+		glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+		glEnableVertexAttribArray(0);
+	}
+	glFinish();
+
+	std::vector<Draw> submitDraws = makeDraws(drawCount, programCount, materialCount, vertexArrayCount, trianglesPerArray);
+	unsigned int materialSum = 0;
+	RenderQueue queue(threads);
+	queue.setMaterialBinder(bindMaterial, &materialSum);
+	SubmitResult unsorted(frameCount);
+	SubmitResult sorted(frameCount);
+	runSubmit(queue, submitDraws, programs, vertexArrays, false, frameCount, unsorted);
+	runSubmit(queue, submitDraws, programs, vertexArrays, true, frameCount, sorted);
+
+	BenchResults results("bench_queue");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("sort_items", sortItems);
+	results.add("programs", programCount);
+	results.add("materials", materialCount);
+	results.add("vertex_arrays", vertexArrayCount);
+	results.add("threads", threads);
+	results.add("unsorted_program_switches", unsortedSwitches.programSwitches);
+	results.add("unsorted_material_switches", unsortedSwitches.materialSwitches);
+	results.add("unsorted_vertex_array_switches", unsortedSwitches.vertexArraySwitches);
+	results.add("sorted_program_switches", sortedSwitches.programSwitches);
+	results.add("sorted_material_switches", sortedSwitches.materialSwitches);
+	results.add("sorted_vertex_array_switches", sortedSwitches.vertexArraySwitches);
+	results.addStats("radix_sort_1_thread_ms", singleSort);
+	results.addStats("radix_sort_parallel_ms", parallelSort);
+	results.addStats("std_sort_keys_ms", stdSort);
+	results.add("submit_draws", drawCount);
+	results.add("submit_frames", frameCount);
+	results.add("unsorted_fps", frameCount / unsorted.seconds);
+	results.add("unsorted_state_changes_per_frame",
+		unsorted.switches.programSwitches + unsorted.switches.vertexArraySwitches + unsorted.switches.materialSwitches);
+	results.addStats("unsorted_cpu_ms", unsorted.cpu);
+	results.addStats("unsorted_gpu_ms", unsorted.gpu);
+	results.add("sorted_fps", frameCount / sorted.seconds);
+	results.add("sorted_state_changes_per_frame",
+		sorted.switches.programSwitches + sorted.switches.vertexArraySwitches + sorted.switches.materialSwitches);
+	results.addStats("sorted_cpu_ms", sorted.cpu);
+	results.addStats("sorted_gpu_ms", sorted.gpu);
+
+	glDeleteVertexArrays(vertexArrayCount, vertexArrays.data());
+	glDeleteBuffers(vertexArrayCount, buffers.data());
+	for (int i = 0; i < programCount; i++)
+		glDeleteProgram(programs[i]);
+	destroyHeadlessContext(headless);
+	return results.write(jsonPath) ? 0 : -1;
+}
@@ -0,0 +1,257 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <glad/glad.h>
+
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "glad_ext.h"
+#include "headless.h"
+#include "program_cache.h"
+#include "scene.h"
+#include "shader_variants.h"
+#include "state_cache.h"
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Renders the scene headless for a fixed number of frames and emits startup
+// and per-frame timings as JSON (stdout unless --json is given)
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int frameCount = 1000;
+	int warmupFrames = 50;
+	bool lazyGL = false;
+	bool stateCache = false;
+	const char* programCachePath = NULL;
+	bool deferredShaders = false;
+	bool spirv = false;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--lazy-gl") == 0)
+			lazyGL = true;
+		else if (strcmp(argv[i], "--state-cache") == 0)
+			stateCache = true;
+		else if (strcmp(argv[i], "--program-cache") == 0 && i + 1 < argc)
+			programCachePath = argv[++i];
+		else if (strcmp(argv[i], "--deferred-shaders") == 0)
+			deferredShaders = true;
+		else if (strcmp(argv[i], "--spirv") == 0)
+			spirv = true;
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--frames N] [--warmup N] [--lazy-gl] [--state-cache]"
+				<< " [--program-cache DIR] [--deferred-shaders] [--spirv] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (frameCount <= 0 || warmupFrames < 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_FRAME_COUNT" << std::endl;
+		return -1;
+	}
+
+	// Startup is split into its phases so a regression can be pinned on one of them
+	std::chrono::steady_clock::time_point startup = std::chrono::steady_clock::now();
+	HeadlessContext headless;
+	if (!createHeadlessContext(headless, width, height))
+		return -1;
+	double contextMs = millisecondsSince(startup);
+
+	std::chrono::steady_clock::time_point phase = std::chrono::steady_clock::now();
+	GLADloadproc loader = (GLADloadproc)headlessGetProcAddress;
+	if (!(lazyGL ? gladLoadGLLoaderLazy(loader) : gladLoadGLLoader(loader)))
+	{
+		std::cout << "ERROR::BENCH::GL_LOAD_FAILED" << std::endl;
+		destroyHeadlessContext(headless);
+		return -1;
+	}
+	double loaderMs = millisecondsSince(phase);
+
+	// A cold cache compiles and stores, a warm one restores from disk
+	phase = std::chrono::steady_clock::now();
+	ProgramCache programCache(programCachePath != NULL ? programCachePath : "");
+	if (programCachePath != NULL)
+		programCache.init();
+	Scene scene;
+	bool parallelCompile = false;
+	bool sceneOk = createHeadlessTarget(headless);
+	if (sceneOk && deferredShaders)
+	{
+		createSceneDeferred(scene);
+		parallelCompile = scene.shaders->parallel();
+	}
+	else if (sceneOk && spirv && createSceneSpirv(scene))
+		sceneOk = true;
+	else if (sceneOk)
+	{
+		spirv = false;
+		sceneOk = createScene(scene, programCachePath != NULL ? &programCache : NULL);
+	}
+	if (!sceneOk)
+	{
+		destroyHeadlessContext(headless);
+		return -1;
+	}
+	glViewport(0, 0, width, height);
+	glFinish();
+	double sceneMs = millisecondsSince(phase);
+	double startupMs = millisecondsSince(startup);
+
+	// With deferred shaders the first frame draws whatever is ready by then
+	phase = std::chrono::steady_clock::now();
+	bool programsReady = !deferredShaders || updateScenePrograms(scene);
+	drawScene(scene);
+	glFinish();
+	double firstFrameMs = millisecondsSince(phase);
+	int framesUntilReady = programsReady ? 0 : 1;
+	while (!programsReady)
+	{
+		programsReady = updateScenePrograms(scene);
+		drawScene(scene);
+		framesUntilReady++;
+	}
+	double programsReadyMs = millisecondsSince(startup);
+
+	// The same setup once more compiling from source, then from the cache
+	// that is now warm either way. After a cold start the driver may still
+	// remember the sources it just compiled, so compare against a warm run.
+	double compileSceneMs = 0.0;
+	double warmSceneMs = 0.0;
+	if (programCachePath != NULL)
+	{
+		phase = std::chrono::steady_clock::now();
+		Scene compiled;
+		createScene(compiled);
+		glFinish();
+		compileSceneMs = millisecondsSince(phase);
+		destroyScene(compiled);
+
+		phase = std::chrono::steady_clock::now();
+		ProgramCache warmCache(programCachePath);
+		warmCache.init();
+		Scene restored;
+		createScene(restored, &warmCache);
+		glFinish();
+		warmSceneMs = millisecondsSince(phase);
+		destroyScene(restored);
+	}
+
+	// Both kinds of shader once more, now that neither is a cold start
+	double glslSceneMs = 0.0;
+	double spirvSceneMs = 0.0;
+	if (spirv)
+	{
+		phase = std::chrono::steady_clock::now();
+		Scene compiled;
+		createScene(compiled);
+		glFinish();
+		glslSceneMs = millisecondsSince(phase);
+		destroyScene(compiled);
+
+		phase = std::chrono::steady_clock::now();
+		Scene specialized;
+		createSceneSpirv(specialized);
+		glFinish();
+		spirvSceneMs = millisecondsSince(phase);
+		destroyScene(specialized);
+	}
+
+	if (stateCache)
+		enableStateCache();
+
+	// Let the driver settle (shader recompiles, buffer placement) before measuring
+	for (int i = 0; i < warmupFrames; i++)
+		drawScene(scene);
+	glFinish();
+
+	// Keep every sample of the run for the percentiles; the frames above
+	// were the warm-up, so the timer needs none of its own
+	FrameTimer frameTimer(4, frameCount, 0);
+	frameTimer.init();
+
+	StateCacheCounters stateTotals = { 0, 0 };
+	stateCacheFrameEnd();
+	std::chrono::steady_clock::time_point loopStart = std::chrono::steady_clock::now();
+	for (int i = 0; i < frameCount; i++)
+	{
+		frameTimer.beginFrame();
+		drawScene(scene);
+		frameTimer.endFrame();
+
+		StateCacheCounters counters = stateCacheFrameEnd();
+		stateTotals.issued += counters.issued;
+		stateTotals.filtered += counters.filtered;
+	}
+	glFinish();
+	double seconds = millisecondsSince(loopStart) / 1000.0;
+	frameTimer.finish();
+
+	BenchResults results("bench_render");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("version", (const char*)glGetString(GL_VERSION));
+	results.add("width", width);
+	results.add("height", height);
+	results.add("lazy_gl", lazyGL ? 1.0 : 0.0);
+	results.add("startup_ms", startupMs);
+	results.add("context_ms", contextMs);
+	results.add("loader_ms", loaderMs);
+	results.add("scene_ms", sceneMs);
+	if (programCachePath != NULL)
+	{
+		results.add("program_cache", programCache.enabled() ? "binary" : "unsupported");
+		results.add("program_cache_hits", programCache.hits());
+		results.add("program_cache_misses", programCache.misses());
+		results.add("program_cache_rejected", programCache.rejected());
+		results.add("scene_compile_ms", compileSceneMs);
+		results.add("scene_warm_cache_ms", warmSceneMs);
+	}
+	results.add("shaders", spirv ? "spirv" : "glsl");
+	if (spirv)
+	{
+		results.add("scene_glsl_ms", glslSceneMs);
+		results.add("scene_spirv_ms", spirvSceneMs);
+	}
+	results.add("first_frame_ms", firstFrameMs);
+	results.add("deferred_shaders", deferredShaders ? (parallelCompile ? "parallel" : "serial") : "off");
+	if (deferredShaders)
+	{
+		results.add("programs_ready_ms", programsReadyMs);
+		results.add("frames_until_programs_ready", framesUntilReady);
+	}
+	results.add("state_cache", stateCache ? 1.0 : 0.0);
+	if (stateCache)
+	{
+		results.add("state_calls_issued_per_frame", (double)stateTotals.issued / frameCount);
+		results.add("state_calls_filtered_per_frame", (double)stateTotals.filtered / frameCount);
+	}
+	results.add("frames", frameCount);
+	results.add("seconds", seconds);
+	results.add("fps", frameCount / seconds);
+	results.addStats("cpu_ms", frameTimer.cpuTimes());
+	results.addStats("gpu_ms", frameTimer.gpuTimes());
+
+	frameTimer.destroy();
+	if (stateCache)
+		disableStateCache();
+	destroyScene(scene);
+	destroyHeadlessContext(headless);
+
+	return results.write(jsonPath) ? 0 : -1;
+}
@@ -0,0 +1,95 @@
+#include "bench_results.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "frame_timer.h"
+
+static std::string encodeString(const char* value)
+{
+	std::string encoded = "\"";
+	for (const char* c = value; *c != '\0'; c++)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			encoded += '\\';
+			encoded += *c;
+		}
+		else if ((unsigned char)*c < 0x20)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+			encoded += escaped;
+		}
+		else
+			encoded += *c;
+	}
+	return encoded + "\"";
+}
+
+static std::string encodeNumber(double value)
+{
+	// JSON has no NaN or infinity
+	if (!std::isfinite(value))
+		return "null";
+
+	// Counts stay exact instead of turning into 1e+06
+	char number[32];
+	if (value == std::floor(value) && std::fabs(value) < 1e15)
+		snprintf(number, sizeof(number), "%.0f", value);
+	else
+		snprintf(number, sizeof(number), "%.6g", value);
+	return number;
+}
+
+BenchResults::BenchResults(const char* benchmark)
+{
+	add("benchmark", benchmark);
+}
+
+void BenchResults::add(const char* key, double value)
+{
+	fields.push_back(std::make_pair(std::string(key), encodeNumber(value)));
+}
+
+void BenchResults::add(const char* key, const char* value)
+{
+	fields.push_back(std::make_pair(std::string(key), encodeString(value != NULL ? value : "")));
+}
+
+void BenchResults::addStats(const char* key, const RollingStats& stats)
+{
+	std::string object = "{ \"count\": " + encodeNumber((double)stats.count());
+	if (stats.count() > 0)
+	{
+		object += ", \"p50\": " + encodeNumber(stats.percentile(0.50))
+			+ ", \"p95\": " + encodeNumber(stats.percentile(0.95))
+			+ ", \"p99\": " + encodeNumber(stats.percentile(0.99))
+			+ ", \"max\": " + encodeNumber(stats.percentile(1.0));
+	}
+	fields.push_back(std::make_pair(std::string(key), object + " }"));
+}
+
+bool BenchResults::write(const char* path) const
+{
+	bool toStdout = path == NULL || strcmp(path, "-") == 0;
+	FILE* file = toStdout ? stdout : fopen(path, "w");
+	if (file == NULL)
+	{
+		std::cout << "ERROR::BENCH::OPEN_FAILED " << path << std::endl;
+		return false;
+	}
+
+	fprintf(file, "{\n");
+	for (size_t i = 0; i < fields.size(); i++)
+		fprintf(file, "\t%s: %s%s\n", encodeString(fields[i].first.c_str()).c_str(), fields[i].second.c_str(),
+			i + 1 < fields.size() ? "," : "");
+	fprintf(file, "}\n");
+
+	if (toStdout)
+		fflush(file);
+	else
+		fclose(file);
+	return true;
+}
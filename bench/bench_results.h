@@ -0,0 +1,31 @@
+#ifndef BENCH_RESULTS_H
+#define BENCH_RESULTS_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class RollingStats;
+
+// Flat JSON object of benchmark results, written once at the end of a run so
+// regression tracking can diff runs key by key
+class BenchResults
+{
+public:
+	BenchResults(const char* benchmark);
+
+	void add(const char* key, double value);
+	void add(const char* key, const char* value);
+
+	// p50/p95/p99/max of the samples as a nested object
+	void addStats(const char* key, const RollingStats& stats);
+
+	// A NULL path or "-" writes to stdout
+	bool write(const char* path) const;
+
+private:
+	// Key and already encoded JSON value, in insertion order
+	std::vector<std::pair<std::string, std::string> > fields;
+};
+
+#endif
@@ -0,0 +1,226 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <glad/glad.h>
+
+#include "bench_context.h"
+#include "bench_results.h"
+#include "frame_timer.h"
+#include "program_reflection.h"
+#include "shader.h"
+
+static const char* vertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"uniform mat4 transform;\n"
+	"uniform vec2 offset;\n"
+	"uniform float scale;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = transform * vec4(aPos.xy * scale + offset, aPos.z, 1.0);\n"
+	"}\0";
+
+static const char* fragmentSource = "#version 330 core\n"
+	"uniform vec4 tint;\n"
+	"uniform float time;\n"
+	"uniform int mode;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = mode == 0 ? tint : tint * (0.5 + 0.5 * sin(time));\n"
+	"}\0";
+
+static const float triangle[] = {
+	-0.01f, -0.01f, 0.0f,
+	0.01f, -0.01f, 0.0f,
+	0.0f, 0.01f, 0.0f
+};
+
+static const float identity[] = {
+	1.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 1.0f
+};
+
+static const unsigned int TRANSFORM = shaderName("transform");
+static const unsigned int OFFSET = shaderName("offset");
+static const unsigned int SCALE = shaderName("scale");
+static const unsigned int TINT = shaderName("tint");
+static const unsigned int TIME = shaderName("time");
+static const unsigned int MODE = shaderName("mode");
+
+enum UniformMode
+{
+	// glGetUniformLocation by string for every value, as naive code does
+	UNIFORMS_BY_NAME,
+	// Locations from the reflection tables, every value sent
+	UNIFORMS_TABLE,
+	// Reflection setters, values equal to the last one dropped
+	UNIFORMS_CACHED
+};
+
+static const char* modeName(UniformMode mode)
+{
+	return mode == UNIFORMS_BY_NAME ? "by_name" : mode == UNIFORMS_TABLE ? "table" : "cached";
+}
+
+// Per draw every uniform is set, as a material-less draw loop would. Only
+// the offset really changes between draws; the tint changes every 16 draws
+// and time once per frame.
+static void drawFrame(UniformMode mode, unsigned int program, ProgramReflection& reflection, int drawCount, float time)
+{
+	for (int i = 0; i < drawCount; i++)
+	{
+		float offset[2] = { (i % 100) / 50.0f - 1.0f, (i / 100 % 100) / 50.0f - 1.0f };
+		float tint[4] = { (i / 16 % 4) / 4.0f, 0.5f, 0.2f, 1.0f };
+		float scale = 1.0f;
+
+		if (mode == UNIFORMS_BY_NAME)
+		{
+			glUniformMatrix4fv(glGetUniformLocation(program, "transform"), 1, GL_FALSE, identity);
+			glUniform2fv(glGetUniformLocation(program, "offset"), 1, offset);
+			glUniform1f(glGetUniformLocation(program, "scale"), scale);
+			glUniform4fv(glGetUniformLocation(program, "tint"), 1, tint);
+			glUniform1f(glGetUniformLocation(program, "time"), time);
+			glUniform1i(glGetUniformLocation(program, "mode"), 1);
+		}
+		else if (mode == UNIFORMS_TABLE)
+		{
+			glUniformMatrix4fv(reflection.uniformLocation(TRANSFORM), 1, GL_FALSE, identity);
+			glUniform2fv(reflection.uniformLocation(OFFSET), 1, offset);
+			glUniform1f(reflection.uniformLocation(SCALE), scale);
+			glUniform4fv(reflection.uniformLocation(TINT), 1, tint);
+			glUniform1f(reflection.uniformLocation(TIME), time);
+			glUniform1i(reflection.uniformLocation(MODE), 1);
+		}
+		else
+		{
+			reflection.setMat4(TRANSFORM, identity);
+			reflection.setVec2(OFFSET, offset);
+			reflection.setFloat(SCALE, scale);
+			reflection.setVec4(TINT, tint);
+			reflection.setFloat(TIME, time);
+			reflection.setInt(MODE, 1);
+		}
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	int width = 800;
+	int height = 600;
+	int drawCount = 10000;
+	int frameCount = 50;
+	const char* jsonPath = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%dx%d", &width, &height);
+		else if (strcmp(argv[i], "--draws") == 0 && i + 1 < argc)
+			drawCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--size WIDTHxHEIGHT] [--draws N] [--frames N] [--json FILE]" << std::endl;
+			return -1;
+		}
+	}
+	if (drawCount <= 0 || frameCount <= 0)
+	{
+		std::cout << "ERROR::BENCH::INVALID_ARGUMENTS" << std::endl;
+		return -1;
+	}
+
+	HeadlessContext headless;
+	if (!createBenchContext(headless, width, height))
+		return -1;
+
+	unsigned int program = createProgram(vertexSource, fragmentSource);
+	if (program == 0)
+	{
+		destroyHeadlessContext(headless);
+		return -1;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	ProgramReflection reflection;
+	bool reflected = reflection.reflect(program);
+	double reflectMs = millisecondsSince(start);
+	if (!reflected)
+	{
+		glDeleteProgram(program);
+		destroyHeadlessContext(headless);
+		return -1;
+	}
+
+	unsigned int vao, vbo;
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glVertexAttribPointer(reflection.attributeLocation(shaderName("aPos")), 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(reflection.attributeLocation(shaderName("aPos")));
+	glUseProgram(program);
+
+	BenchResults results("bench_uniforms");
+	results.add("renderer", (const char*)glGetString(GL_RENDERER));
+	results.add("draws", drawCount);
+	results.add("frames", frameCount);
+	results.add("uniforms", (double)reflection.uniforms().size());
+	results.add("reflect_ms", reflectMs);
+
+	const UniformMode modes[] = { UNIFORMS_BY_NAME, UNIFORMS_TABLE, UNIFORMS_CACHED };
+	for (int m = 0; m < 3; m++)
+	{
+		// One untimed frame so every mode starts from a warm driver
+		reflection.forgetValues();
+		drawFrame(modes[m], program, reflection, drawCount, 0.0f);
+		glFinish();
+
+		FrameTimer frameTimer(4, frameCount);
+		frameTimer.init();
+		int uploads = reflection.uploads();
+		int skipped = reflection.skipped();
+		for (int frame = 0; frame < frameCount; frame++)
+		{
+			frameTimer.beginFrame();
+			glClear(GL_COLOR_BUFFER_BIT);
+			drawFrame(modes[m], program, reflection, drawCount, frame * 0.016f);
+			frameTimer.endFrame();
+		}
+		glFinish();
+		frameTimer.finish();
+
+		std::string prefix = modeName(modes[m]);
+		results.addStats((prefix + "_cpu_ms").c_str(), frameTimer.cpuTimes());
+		results.addStats((prefix + "_gpu_ms").c_str(), frameTimer.gpuTimes());
+		if (modes[m] == UNIFORMS_CACHED)
+		{
+			results.add("cached_uploads_per_frame", (double)(reflection.uploads() - uploads) / frameCount);
+			results.add("cached_skipped_per_frame", (double)(reflection.skipped() - skipped) / frameCount);
+		}
+		frameTimer.destroy();
+	}
+
+	results.write(jsonPath);
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &vbo);
+	glDeleteProgram(program);
+	destroyHeadlessContext(headless);
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <glad/glad.h>
+#if !defined(__linux__)
+#include <GLFW/glfw3.h>
+#endif
+
+#include "gl_trace.h"
+#include "headless.h"
+
+// Replays a trace recorded with learnopengl1 --capture as fast as possible,
+// to measure driver and submission cost on a frozen workload
+int main(int argc, char** argv)
+{
+	const char* tracePath = NULL;
+	int repeat = 100;
+	int width = 800;
+	int height = 600;
+
+	bool usage = false;
+	for (int i = 1; i < argc && !usage; i++)
+	{
+		if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+			repeat = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+		{
+			if (sscanf(argv[++i], "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0)
+			{
+				std::cout << "Invalid --size, expected WIDTHxHEIGHT" << std::endl;
+				return -1;
+			}
+		}
+		else if (tracePath == NULL && argv[i][0] != '-')
+			tracePath = argv[i];
+		else
+			usage = true;
+	}
+	if (usage || tracePath == NULL || repeat <= 0)
+	{
+		std::cout << "Usage: " << argv[0] << " TRACE [--repeat N] [--size WIDTHxHEIGHT]" << std::endl;
+		return -1;
+	}
+
+	// Surfaceless EGL on Linux, so the replay needs no display or GLFW there,
+	// and a hidden window everywhere else
+	HeadlessContext headless;
+	GLADloadproc loader = (GLADloadproc)headlessGetProcAddress;
+#if defined(__linux__)
+	bool offscreen = true;
+	if (!createHeadlessContext(headless, width, height))
+		return -1;
+#else
+	bool offscreen = false;
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	GLFWwindow* window = glfwCreateWindow(width, height, "glreplay", NULL, NULL);
+	if (window == NULL)
+	{
+		std::cout << "Failed to create a GL context" << std::endl;
+		glfwTerminate();
+		return -1;
+	}
+	glfwMakeContextCurrent(window);
+	loader = (GLADloadproc)glfwGetProcAddress;
+#endif
+
+	if (!gladLoadGLLoader(loader) || (offscreen && !createHeadlessTarget(headless)))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		return -1;
+	}
+
+	TraceReplayer replayer;
+	if (!replayer.load(tracePath))
+		return -1;
+	std::cout << "Replaying " << replayer.commandCount() << " commands, " << replayer.frameCount()
+		<< " frames x " << repeat << " on " << (const char*)glGetString(GL_RENDERER) << std::endl;
+
+	std::chrono::steady_clock::time_point setupStart = std::chrono::steady_clock::now();
+	replayer.replaySetup();
+	glFinish();
+	double setupMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - setupStart).count();
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	int frames = 0;
+	for (int i = 0; i < repeat; i++)
+		frames += replayer.replayFrames();
+	glFinish();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Setup: " << setupMs << " ms" << std::endl
+		<< "Frames: " << frames << " in " << seconds << " s (" << frames / seconds << " FPS, "
+		<< (replayer.frameCommandCount() * (double)repeat) / seconds / 1.0e6 << " M commands/s)" << std::endl;
+
+	replayer.destroy();
+#if defined(__linux__)
+	destroyHeadlessContext(headless);
+#else
+	glfwTerminate();
+#endif
+	return 0;
+}
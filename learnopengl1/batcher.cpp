@@ -0,0 +1,127 @@
+#include "batcher.h"
+
+#include <cstring>
+#include <glad/glad.h>
+#include "shader.h"
+
+static const char* batchVertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec4 aColor;\n"
+	"out vec4 color;\n"
+	"void main()\n"
+	"{\n"
+	"	color = aColor;\n"
+	"	gl_Position = vec4(aPos, 1.0);\n"
+	"}\0";
+
+static const char* batchFragmentSource = "#version 330 core\n"
+	"in vec4 color;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = color;\n"
+	"}\0";
+
+static unsigned int toByte(float value)
+{
+	if (value <= 0.0f)
+		return 0;
+	if (value >= 1.0f)
+		return 255;
+	return (unsigned int)(value * 255.0f + 0.5f);
+}
+
+unsigned int packColor(float r, float g, float b, float a)
+{
+	// Bytes in memory are r, g, b, a on little endian machines
+	return toByte(r) | (toByte(g) << 8) | (toByte(b) << 16) | (toByte(a) << 24);
+}
+
+Batcher::Batcher(size_t maxVertices)
+	: capacity(maxVertices >= 3 ? maxVertices - maxVertices % 3 : 3), lastDrawCalls(0), program(0), VAO(0),
+	stream(GL_ARRAY_BUFFER, capacity * sizeof(Vertex))
+{
+}
+
+bool Batcher::init()
+{
+	program = createProgram(batchVertexSource, batchFragmentSource);
+	if (program == 0)
+		return false;
+
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+	stream.init();
+
+	// Position is 3 floats, color 4 normalised bytes. Attributes point at
+	// the start of the ring, draws pick their region with the first vertex.
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	glBindVertexArray(0);
+	return true;
+}
+
+void Batcher::destroy()
+{
+	glDeleteVertexArrays(1, &VAO);
+	stream.destroy();
+	glDeleteProgram(program);
+	VAO = 0;
+	program = 0;
+}
+
+void Batcher::begin()
+{
+	vertices.clear();
+}
+
+void Batcher::addTriangle(const float* positions, unsigned int color)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		Vertex vertex = { positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2], color };
+		vertices.push_back(vertex);
+	}
+}
+
+void Batcher::addQuad(float x, float y, float width, float height, unsigned int color)
+{
+	Vertex corners[4] = {
+		{ x, y, 0.0f, color },
+		{ x + width, y, 0.0f, color },
+		{ x + width, y + height, 0.0f, color },
+		{ x, y + height, 0.0f, color }
+	};
+	vertices.push_back(corners[0]);
+	vertices.push_back(corners[1]);
+	vertices.push_back(corners[2]);
+	vertices.push_back(corners[0]);
+	vertices.push_back(corners[2]);
+	vertices.push_back(corners[3]);
+}
+
+void Batcher::flush()
+{
+	lastDrawCalls = 0;
+	if (vertices.empty())
+		return;
+
+	glUseProgram(program);
+	glBindVertexArray(VAO);
+
+	for (size_t first = 0; first < vertices.size(); first += capacity)
+	{
+		size_t count = vertices.size() - first < capacity ? vertices.size() - first : capacity;
+
+		size_t offset;
+		void* destination = stream.map(count * sizeof(Vertex), sizeof(Vertex), offset);
+		memcpy(destination, &vertices[first], count * sizeof(Vertex));
+		stream.unmap();
+
+		glDrawArrays(GL_TRIANGLES, (int)(offset / sizeof(Vertex)), (int)count);
+		lastDrawCalls++;
+	}
+}
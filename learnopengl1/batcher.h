@@ -0,0 +1,58 @@
+#ifndef BATCHER_H
+#define BATCHER_H
+
+#include <cstddef>
+#include <vector>
+#include "stream_buffer.h"
+
+// Pack an RGBA color into the byte order the batcher's vertices use
+unsigned int packColor(float r, float g, float b, float a = 1.0f);
+
+// Collects colored triangles on the CPU and sends the whole lot as one
+// streamed upload and one draw call, instead of a program switch, VAO bind
+// and draw per shape. Uploads go through a StreamBuffer. Color is a vertex attribute, so shapes of any color
+// share the single program.
+class Batcher
+{
+public:
+	struct Vertex
+	{
+		float x, y, z;
+		unsigned int color;
+	};
+
+	// maxVertices is the size of one streaming region and caps a single
+	// draw; bigger batches are split into several draws of that size
+	Batcher(size_t maxVertices = 1 << 19);
+
+	// Needs a current context with GL functions loaded
+	bool init();
+	void destroy();
+
+	void begin();
+
+	// positions holds x, y, z for each corner
+	void addTriangle(const float* positions, unsigned int color);
+
+	// Axis aligned rectangle as two triangles
+	void addQuad(float x, float y, float width, float height, unsigned int color);
+
+	// Upload and draw everything added since begin()
+	void flush();
+
+	size_t vertexCount() const { return vertices.size(); }
+	int drawCalls() const { return lastDrawCalls; }
+
+	const StreamBuffer& streamBuffer() const { return stream; }
+
+private:
+	std::vector<Vertex> vertices;
+	size_t capacity;
+	int lastDrawCalls;
+
+	unsigned int program;
+	unsigned int VAO;
+	StreamBuffer stream;
+};
+
+#endif
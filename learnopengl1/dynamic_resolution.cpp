@@ -0,0 +1,292 @@
+#include "dynamic_resolution.h"
+
+#include <cmath>
+#include <iostream>
+#include <glad/glad.h>
+
+#include "shader.h"
+
+// Scales move in steps of this, so noise doesn't change them every frame
+static const float SCALE_STEP = 1.0f / 32.0f;
+
+// Shrink when over budget, grow only when well under it
+static const double TARGET_LOAD = 0.85;
+static const double GROW_LOAD = 0.7;
+// Growing is limited per change, overshooting the budget costs more than staying small
+static const float MAX_GROWTH = 1.1f;
+
+// Scene timings in flight, as for FrameTimer
+static const int QUERY_COUNT = 4;
+
+// Weight of a new sample in the smoothed GPU time
+static const double SMOOTHING = 0.3;
+
+// A sample this many times the smoothed time is taken for a hitch and
+// dropped, unless MAX_OUTLIERS of them come in a row
+static const double OUTLIER_FACTOR = 4.0;
+static const int MAX_OUTLIERS = 2;
+
+// One triangle covering the output, reading the used corner of the target
+static const char* upscaleVertexSource = "#version 330 core\n"
+	"uniform vec2 usedArea;\n"
+	"out vec2 uv;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 corner = vec2(gl_VertexID == 1 ? 2.0 : 0.0, gl_VertexID == 2 ? 2.0 : 0.0);\n"
+	"	uv = corner * usedArea;\n"
+	"	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);\n"
+	"}\0";
+
+static const char* upscaleFragmentSource = "#version 330 core\n"
+	"uniform sampler2D scene;\n"
+	"in vec2 uv;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = texture(scene, uv);\n"
+	"}\0";
+
+DynamicResolution::DynamicResolution()
+	: FBO(0), colorTexture(0), upscaleProgram(0), usedAreaLocation(-1), emptyVAO(0), targetWidth(0), targetHeight(0), outputWidth(0), outputHeight(0),
+	outputFBO(0), direct(false), queries(QUERY_COUNT), currentQuery(0), queryActive(false),
+	budget(0.0), minScale(0.5f), maxScale(1.0f), currentScale(1.0f),
+	frame(0), changedAt(0), lastSample(-1), smoothed(-1.0), outliers(0), changeCount(0), scales(4096)
+{
+}
+
+bool DynamicResolution::init(int outputWidth, int outputHeight, double budgetMs, float minScale, float maxScale)
+{
+	budget = budgetMs;
+	this->minScale = minScale > 0.0f ? minScale : SCALE_STEP;
+	this->maxScale = maxScale > this->minScale ? maxScale : this->minScale;
+	currentScale = this->maxScale;
+	frame = 0;
+	// Like FrameTimer's warm-up: the first frame pays for setup the driver
+	// put off, so its time is left out
+	changedAt = 1;
+	lastSample = -1;
+	smoothed = -1.0;
+	outliers = 0;
+	changeCount = 0;
+	scales.clear();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		glGenQueries(1, &queries[i].begin);
+		glGenQueries(1, &queries[i].end);
+		queries[i].pending = false;
+	}
+	currentQuery = 0;
+	queryActive = false;
+
+	upscaleProgram = createProgram(upscaleVertexSource, upscaleFragmentSource);
+	if (upscaleProgram == 0)
+		return false;
+	usedAreaLocation = glGetUniformLocation(upscaleProgram, "usedArea");
+	glUseProgram(upscaleProgram);
+	glUniform1i(glGetUniformLocation(upscaleProgram, "scene"), 0);
+
+	// Core profile wants a vertex array even when nothing is read from one
+	glGenVertexArrays(1, &emptyVAO);
+
+	glGenFramebuffers(1, &FBO);
+	glGenTextures(1, &colorTexture);
+	return resize(outputWidth, outputHeight);
+}
+
+void DynamicResolution::destroy()
+{
+	glDeleteFramebuffers(1, &FBO);
+	glDeleteTextures(1, &colorTexture);
+	glDeleteVertexArrays(1, &emptyVAO);
+	glDeleteProgram(upscaleProgram);
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		glDeleteQueries(1, &queries[i].begin);
+		glDeleteQueries(1, &queries[i].end);
+		queries[i].begin = queries[i].end = 0;
+		queries[i].pending = false;
+	}
+	FBO = 0;
+	colorTexture = 0;
+	emptyVAO = 0;
+	upscaleProgram = 0;
+	targetWidth = 0;
+	targetHeight = 0;
+}
+
+bool DynamicResolution::resize(int outputWidth, int outputHeight)
+{
+	// Minimized windows report 0x0, keep what we have
+	if (outputWidth <= 0 || outputHeight <= 0)
+		return true;
+	this->outputWidth = outputWidth;
+	this->outputHeight = outputHeight;
+
+	int width = (int)std::ceil(outputWidth * maxScale);
+	int height = (int)std::ceil(outputHeight * maxScale);
+	if (width <= targetWidth && height <= targetHeight)
+		return true;
+
+	// Grow to cover both axes, a shrinking window keeps the bigger target
+	return allocate(width > targetWidth ? width : targetWidth, height > targetHeight ? height : targetHeight);
+}
+
+bool DynamicResolution::allocate(int width, int height)
+{
+	// A single color texture is enough, the scene has no depth
+	glBindTexture(GL_TEXTURE_2D, colorTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	targetWidth = width;
+	targetHeight = height;
+
+	GLint previous = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+	glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, previous);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "ERROR::DYNAMIC_RESOLUTION::FRAMEBUFFER_INCOMPLETE" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+int DynamicResolution::renderWidth() const
+{
+	int width = (int)(outputWidth * currentScale + 0.5f);
+	return width > 0 ? width : 1;
+}
+
+int DynamicResolution::renderHeight() const
+{
+	int height = (int)(outputHeight * currentScale + 0.5f);
+	return height > 0 ? height : 1;
+}
+
+void DynamicResolution::beginFrame(unsigned int outputFramebuffer)
+{
+	// Read back the scene times the GPU has finished, oldest first
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		SceneQuery& query = queries[(currentQuery + i) % queries.size()];
+		if (!query.pending)
+			continue;
+
+		int available = 0;
+		glGetQueryObjectiv(query.end, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+		GLuint64 begin = 0;
+		GLuint64 end = 0;
+		glGetQueryObjectui64v(query.begin, GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(query.end, GL_QUERY_RESULT, &end);
+		query.pending = false;
+		update(query.frame, (end - begin) / 1.0e6);
+	}
+
+	outputFBO = outputFramebuffer;
+	direct = renderWidth() == outputWidth && renderHeight() == outputHeight;
+	if (direct)
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+		glViewport(0, 0, outputWidth, outputHeight);
+	}
+	else
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+		glViewport(0, 0, renderWidth(), renderHeight());
+
+		// Clears ignore the viewport, the scissor keeps them to the used corner
+		glScissor(0, 0, renderWidth(), renderHeight());
+		glEnable(GL_SCISSOR_TEST);
+	}
+
+	// A ring behind means no timing for this frame rather than a wait
+	SceneQuery& query = queries[currentQuery];
+	queryActive = !query.pending;
+	if (queryActive)
+	{
+		glQueryCounter(query.begin, GL_TIMESTAMP);
+		query.frame = frame;
+	}
+	scales.add(currentScale);
+	frame++;
+}
+
+void DynamicResolution::endFrame()
+{
+	if (queryActive)
+	{
+		glQueryCounter(queries[currentQuery].end, GL_TIMESTAMP);
+		queries[currentQuery].pending = true;
+		currentQuery = (currentQuery + 1) % queries.size();
+		queryActive = false;
+	}
+	if (direct)
+		return;
+
+	// A bilinear draw rather than a scaled glBlitFramebuffer, which
+	// software rasterizers run on a slow path
+	glDisable(GL_SCISSOR_TEST);
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+	glViewport(0, 0, outputWidth, outputHeight);
+	glUseProgram(upscaleProgram);
+	glUniform2f(usedAreaLocation, (float)renderWidth() / targetWidth, (float)renderHeight() / targetHeight);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, colorTexture);
+	glBindVertexArray(emptyVAO);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void DynamicResolution::update(long long sampleFrame, double gpuMs)
+{
+	// beginFrame has already counted the frames, sampleFrame starts at 0
+	if (sampleFrame <= lastSample || sampleFrame < changedAt)
+		return;
+	lastSample = sampleFrame;
+
+	if (smoothed > 0.0 && gpuMs > smoothed * OUTLIER_FACTOR && outliers < MAX_OUTLIERS)
+	{
+		outliers++;
+		return;
+	}
+	outliers = 0;
+
+	smoothed = smoothed < 0.0 ? gpuMs : smoothed + (gpuMs - smoothed) * SMOOTHING;
+	if (smoothed <= 0.0 || (smoothed <= budget && smoothed >= budget * GROW_LOAD))
+		return;
+
+	// Fill cost goes with the pixel count, i.e. with the scale squared
+	float wanted = currentScale * (float)std::sqrt(budget * TARGET_LOAD / smoothed);
+	if (wanted > currentScale * MAX_GROWTH)
+		wanted = currentScale * MAX_GROWTH;
+	wanted = std::floor(wanted / SCALE_STEP) * SCALE_STEP;
+	if (wanted < minScale)
+		wanted = minScale;
+	if (wanted > maxScale)
+		wanted = maxScale;
+	if (wanted == currentScale)
+		return;
+
+	// Frames still in flight were drawn at the old scale
+	currentScale = wanted;
+	changedAt = frame;
+	smoothed = -1.0;
+	outliers = 0;
+	changeCount++;
+}
+
+void DynamicResolution::printSummary(std::ostream& out) const
+{
+	out << "Dynamic resolution: scale p5/p50/p95 " << scales.percentile(0.05) << " / " << scales.percentile(0.50)
+		<< " / " << scales.percentile(0.95) << ", " << changeCount << " changes, now "
+		<< renderWidth() << "x" << renderHeight() << " of " << outputWidth << "x" << outputHeight << std::endl;
+}
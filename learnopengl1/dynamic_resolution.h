@@ -0,0 +1,97 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+#include <ostream>
+#include <vector>
+
+#include "frame_timer.h"
+
+// Dynamic resolution: the scene is drawn into an offscreen target at a
+// fraction of the output size and stretched onto the output with a
+// bilinear fullscreen pass. At full scale the scene goes straight to the
+// output and there is no pass at all. A controller picks the fraction so
+// the scene stays within a time budget, which helps wherever fill rate is
+// the limit, as on software rasterizers.
+//
+// The scene is timed on its own with a pair of GL_TIMESTAMP queries, so
+// the fixed cost of the upscale doesn't count against the budget (and
+// the timing works inside a FrameTimer's GL_TIME_ELAPSED query). Results
+// are read back a few frames late, like FrameTimer's.
+//
+// The target is allocated once for the largest scale and a smaller scale
+// only uses its lower-left corner, so changing the scale never reallocates.
+// Resizing the output only reallocates when it grows past the target.
+class DynamicResolution
+{
+public:
+	DynamicResolution();
+
+	// Needs a current context with GL functions loaded. Scales are per axis.
+	bool init(int outputWidth, int outputHeight, double budgetMs, float minScale = 0.5f, float maxScale = 1.0f);
+	void destroy();
+
+	// New output size, e.g. from the framebuffer size callback
+	bool resize(int outputWidth, int outputHeight);
+
+	// Bind the target at the current scale for the scene to draw into, or
+	// outputFramebuffer itself at full scale; also feeds the controller
+	// the scene times that have come back
+	void beginFrame(unsigned int outputFramebuffer);
+	// Stretch the scene onto the output framebuffer and leave that bound
+	void endFrame();
+
+	float scale() const { return currentScale; }
+	int renderWidth() const;
+	int renderHeight() const;
+	int changes() const { return changeCount; }
+
+	void printSummary(std::ostream& out) const;
+
+private:
+	struct SceneQuery
+	{
+		unsigned int begin;
+		unsigned int end;
+		long long frame;
+		bool pending;
+	};
+
+	bool allocate(int width, int height);
+	// GPU time of the scene in frame sampleFrame. Samples from before the
+	// last scale change are dropped, and so are isolated spikes far above
+	// the running average.
+	void update(long long sampleFrame, double gpuMs);
+
+	unsigned int FBO;
+	unsigned int colorTexture;
+	unsigned int upscaleProgram;
+	int usedAreaLocation;
+	unsigned int emptyVAO;
+	int targetWidth;
+	int targetHeight;
+	int outputWidth;
+	int outputHeight;
+	unsigned int outputFBO;
+	// This frame's scene went straight to the output
+	bool direct;
+
+	std::vector<SceneQuery> queries;
+	int currentQuery;
+	bool queryActive;
+
+	double budget;
+	float minScale;
+	float maxScale;
+	float currentScale;
+
+	long long frame;
+	long long changedAt;
+	long long lastSample;
+	double smoothed;
+	// Spikes dropped in a row
+	int outliers;
+	int changeCount;
+	RollingStats scales;
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include "frame_pacer.h"
+
+#include <iostream>
+#include <thread>
+#include <glad/glad.h>
+
+// Sleeps end this much before the deadline, the rest is spun
+static const std::chrono::microseconds spinMargin(2000);
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+FramePacer::FramePacer(size_t window)
+	: framesInFlight(0), period(0), deadlineSet(false), latency(window), fenceWait(window), limiterWait(window)
+{
+}
+
+void FramePacer::init(int framesInFlight, double targetRate)
+{
+	this->framesInFlight = framesInFlight > 0 ? framesInFlight : 0;
+	period = targetRate > 0.0
+		? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / targetRate))
+		: std::chrono::steady_clock::duration(0);
+	deadlineSet = false;
+	inputTime = std::chrono::steady_clock::now();
+}
+
+void FramePacer::destroy()
+{
+	for (size_t i = 0; i < frames.size(); i++)
+		glDeleteSync((GLsync)frames[i].fence);
+	frames.clear();
+}
+
+void FramePacer::retire(bool block)
+{
+	while (!frames.empty())
+	{
+		GLsync fence = (GLsync)frames.front().fence;
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED && block)
+		{
+			do
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			while (result == GL_TIMEOUT_EXPIRED);
+		}
+		if (result == GL_TIMEOUT_EXPIRED)
+			return;
+		if (result == GL_WAIT_FAILED)
+			std::cout << "ERROR::FRAME_PACER::WAIT_FAILED" << std::endl;
+		else
+			latency.add(millisecondsSince(frames.front().inputTime));
+
+		glDeleteSync(fence);
+		frames.pop_front();
+
+		// Only block for as long as the cap needs
+		if (block && (int)frames.size() < framesInFlight)
+			block = false;
+	}
+}
+
+void FramePacer::beginFrame()
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	retire(framesInFlight > 0 && (int)frames.size() >= framesInFlight);
+	fenceWait.add(millisecondsSince(start));
+
+	if (period.count() == 0)
+		return;
+
+	start = std::chrono::steady_clock::now();
+	if (!deadlineSet)
+	{
+		deadline = start;
+		deadlineSet = true;
+	}
+	else
+	{
+		deadline += period;
+		// More than a frame late: start over instead of rushing to catch up
+		if (start > deadline + period)
+			deadline = start;
+	}
+
+	if (deadline - start > spinMargin)
+		std::this_thread::sleep_for(deadline - start - spinMargin);
+	while (std::chrono::steady_clock::now() < deadline)
+		;
+	limiterWait.add(millisecondsSince(start));
+}
+
+void FramePacer::inputSampled()
+{
+	inputTime = std::chrono::steady_clock::now();
+}
+
+void FramePacer::endFrame()
+{
+	InFlight frame;
+	frame.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	frame.inputTime = inputTime;
+	frames.push_back(frame);
+
+	// Submit the fence now, polling it without the flush bit won't
+	glFlush();
+}
+
+void FramePacer::printSummary(std::ostream& out) const
+{
+	out << "Input latency ms p50/p95/p99: " << latency.percentile(0.50) << " / " << latency.percentile(0.95)
+		<< " / " << latency.percentile(0.99)
+		<< "  fence wait ms p50/p99: " << fenceWait.percentile(0.50) << " / " << fenceWait.percentile(0.99)
+		<< "  limiter wait ms p50/p99: " << limiterWait.percentile(0.50) << " / " << limiterWait.percentile(0.99)
+		<< std::endl;
+}
@@ -0,0 +1,72 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+#include <deque>
+#include <ostream>
+
+#include "frame_timer.h"
+
+// Low-latency frame pacing.
+//
+// Drivers happily queue several frames ahead, and every queued frame is
+// input that is that much older by the time it reaches the screen. The
+// pacer puts a fence after each frame's swap and, before a new frame
+// starts, waits until at most framesInFlight frames are still on the GPU.
+// An optional limiter then holds the frame back until its deadline,
+// sleeping most of the way and spinning the last bit, because sleeps
+// overshoot by up to a scheduler tick. Input is sampled after both waits,
+// as late as possible.
+//
+// Input latency is measured per frame, from input sampling to the frame's
+// fence signalling, i.e. to the GPU finishing the frame including the
+// swap's blit (the display may still add a scan-out on top). Fences are
+// polled once per frame, so the figure can be up to a frame high.
+class FramePacer
+{
+public:
+	FramePacer(size_t window = 512);
+
+	// Needs a current context with GL functions loaded. framesInFlight 0
+	// leaves queueing to the driver, targetRate 0 turns the limiter off.
+	void init(int framesInFlight, double targetRate);
+	void destroy();
+
+	// Before sampling input: wait for a free frame slot and the deadline
+	void beginFrame();
+	// Right after processing input
+	void inputSampled();
+	// Right after the swap
+	void endFrame();
+
+	// Milliseconds from input sampling to GPU completion
+	const RollingStats& inputLatency() const { return latency; }
+	// Milliseconds spent blocked on the frames-in-flight cap and the limiter
+	const RollingStats& fenceWaits() const { return fenceWait; }
+	const RollingStats& limiterWaits() const { return limiterWait; }
+
+	void printSummary(std::ostream& out) const;
+
+private:
+	struct InFlight
+	{
+		// GLsync of the frame's swap
+		void* fence;
+		std::chrono::steady_clock::time_point inputTime;
+	};
+
+	void retire(bool block);
+
+	int framesInFlight;
+	std::chrono::steady_clock::duration period;
+	std::chrono::steady_clock::time_point deadline;
+	bool deadlineSet;
+	std::chrono::steady_clock::time_point inputTime;
+	std::deque<InFlight> frames;
+
+	RollingStats latency;
+	RollingStats fenceWait;
+	RollingStats limiterWait;
+};
+
+#endif
@@ -0,0 +1,183 @@
+#include "frame_timer.h"
+
+#include <algorithm>
+#include <glad/glad.h>
+
+RollingStats::RollingStats(size_t capacity)
+	: capacity(capacity > 0 ? capacity : 1), next(0)
+{
+	samples.reserve(capacity);
+	scratch.reserve(capacity);
+}
+
+void RollingStats::add(double value)
+{
+	// Overwrite the oldest sample once the window is full
+	if (samples.size() < capacity)
+		samples.push_back(value);
+	else
+		samples[next] = value;
+	next = (next + 1) % capacity;
+}
+
+void RollingStats::clear()
+{
+	samples.clear();
+	next = 0;
+}
+
+size_t RollingStats::count() const
+{
+	return samples.size();
+}
+
+double RollingStats::percentile(double p) const
+{
+	if (samples.empty())
+		return 0.0;
+
+	scratch.assign(samples.begin(), samples.end());
+	size_t rank = (size_t)(p * (scratch.size() - 1) + 0.5);
+	std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+	return scratch[rank];
+}
+
+FrameTimer::FrameTimer(int queryCount, size_t window, int warmupFrames)
+	: slots(queryCount > 0 ? queryCount : 1), current(0), queryActive(false), frame(0), warmup(warmupFrames > 0 ? warmupFrames : 0),
+	lastGpu(0.0), cpu(window), gpu(window), csv(NULL)
+{
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		slots[i].query = 0;
+		slots[i].pending = false;
+	}
+}
+
+FrameTimer::~FrameTimer()
+{
+	if (csv != NULL)
+		fclose(csv);
+}
+
+void FrameTimer::init()
+{
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		glGenQueries(1, &slots[i].query);
+		slots[i].pending = false;
+	}
+}
+
+void FrameTimer::destroy()
+{
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		glDeleteQueries(1, &slots[i].query);
+		slots[i].query = 0;
+		slots[i].pending = false;
+	}
+}
+
+bool FrameTimer::openCsv(const char* path)
+{
+	csv = fopen(path, "w");
+	if (csv == NULL)
+		return false;
+
+	fprintf(csv, "frame,cpu_ms,gpu_ms\n");
+	return true;
+}
+
+void FrameTimer::beginFrame()
+{
+	// Read back whatever the GPU has finished, oldest first. Results land in
+	// submission order, so stop at the first one that isn't there yet.
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		QuerySlot& slot = slots[(current + i) % slots.size()];
+		if (!slot.pending)
+			continue;
+
+		int available = 0;
+		glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+		collect(slot);
+	}
+
+	cpuStart = std::chrono::steady_clock::now();
+
+	// If the GPU is more than a ring behind, skip GPU timing for this frame
+	// rather than waiting on the query we would reuse
+	queryActive = !slots[current].pending;
+	if (queryActive)
+		glBeginQuery(GL_TIME_ELAPSED, slots[current].query);
+}
+
+void FrameTimer::endFrame()
+{
+	double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cpuStart).count();
+	if (frame >= warmup)
+		cpu.add(cpuMs);
+
+	if (queryActive)
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		slots[current].frame = frame;
+		slots[current].cpuMs = cpuMs;
+		slots[current].pending = true;
+		current = (current + 1) % slots.size();
+		queryActive = false;
+	}
+	else
+	{
+		writeCsv(frame, cpuMs, -1.0);
+	}
+
+	frame++;
+}
+
+void FrameTimer::finish()
+{
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		QuerySlot& slot = slots[(current + i) % slots.size()];
+		if (slot.pending)
+			collect(slot);
+	}
+}
+
+void FrameTimer::collect(QuerySlot& slot)
+{
+	GLuint64 elapsed = 0;
+	glGetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &elapsed);
+	slot.pending = false;
+	if (slot.frame < warmup)
+	{
+		writeCsv(slot.frame, slot.cpuMs, -1.0);
+		return;
+	}
+
+	lastGpu = elapsed / 1.0e6;
+	gpu.add(lastGpu);
+	writeCsv(slot.frame, slot.cpuMs, lastGpu);
+}
+
+void FrameTimer::writeCsv(long long frame, double cpuMs, double gpuMs)
+{
+	if (csv == NULL)
+		return;
+
+	// Frames without a GPU sample leave the column empty
+	if (gpuMs < 0.0)
+		fprintf(csv, "%lld,%.4f,\n", frame, cpuMs);
+	else
+		fprintf(csv, "%lld,%.4f,%.4f\n", frame, cpuMs, gpuMs);
+}
+
+void FrameTimer::printSummary(std::ostream& out) const
+{
+	out << "CPU ms p50/p95/p99: " << cpu.percentile(0.50) << " / " << cpu.percentile(0.95) << " / " << cpu.percentile(0.99)
+		<< "  GPU ms p50/p95/p99: " << gpu.percentile(0.50) << " / " << gpu.percentile(0.95) << " / " << gpu.percentile(0.99)
+		<< std::endl;
+}
@@ -0,0 +1,90 @@
+#ifndef FRAME_TIMER_H
+#define FRAME_TIMER_H
+
+#include <chrono>
+#include <cstdio>
+#include <ostream>
+#include <vector>
+
+// Fixed-size window of the most recent samples with percentile queries
+class RollingStats
+{
+public:
+	RollingStats(size_t capacity = 512);
+
+	void add(double value);
+	void clear();
+	size_t count() const;
+
+	// p in [0, 1], nearest-rank over the samples currently in the window
+	double percentile(double p) const;
+
+private:
+	std::vector<double> samples;
+	size_t capacity;
+	size_t next;
+	mutable std::vector<double> scratch;
+};
+
+// Per-frame CPU and GPU timing.
+// GPU time comes from a ring of GL_TIME_ELAPSED queries that is read back
+// several frames late, and a query is only polled once its result is
+// available, so measuring never makes the CPU wait for the GPU.
+//
+// The first warmupFrames frames are timed but kept out of the stats and
+// the CSV's GPU column: some drivers report nonsense for the first query
+// of a context (llvmpipe says hours for frame 0), and first frames pay for
+// shader and buffer setup the driver put off.
+class FrameTimer
+{
+public:
+	FrameTimer(int queryCount = 4, size_t window = 512, int warmupFrames = 1);
+	~FrameTimer();
+
+	// Needs a current context with GL functions loaded
+	void init();
+	void destroy();
+
+	// Optional per-frame log with columns frame,cpu_ms,gpu_ms
+	bool openCsv(const char* path);
+
+	void beginFrame();
+	void endFrame();
+
+	// Block until every outstanding query has landed (call before reporting at exit)
+	void finish();
+
+	const RollingStats& cpuTimes() const { return cpu; }
+	const RollingStats& gpuTimes() const { return gpu; }
+
+	// Most recent GPU frame time that has been read back, in milliseconds
+	double lastGpuTime() const { return lastGpu; }
+
+	void printSummary(std::ostream& out) const;
+
+private:
+	struct QuerySlot
+	{
+		unsigned int query;
+		long long frame;
+		double cpuMs;
+		bool pending;
+	};
+
+	void collect(QuerySlot& slot);
+	void writeCsv(long long frame, double cpuMs, double gpuMs);
+
+	std::vector<QuerySlot> slots;
+	int current;
+	bool queryActive;
+	long long frame;
+	long long warmup;
+	std::chrono::steady_clock::time_point cpuStart;
+	double lastGpu;
+
+	RollingStats cpu;
+	RollingStats gpu;
+	FILE* csv;
+};
+
+#endif
@@ -0,0 +1,346 @@
+#include "gl_trace.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "glad_ext.h"
+
+// Records are collected here and written out at frame ends
+static std::vector<unsigned char> traceBuffer;
+static FILE* traceFile = NULL;
+
+static void flushTrace()
+{
+	if (!traceBuffer.empty())
+		fwrite(traceBuffer.data(), 1, traceBuffer.size(), traceFile);
+	traceBuffer.clear();
+}
+
+static void putBytes(const void* bytes, size_t size)
+{
+	const unsigned char* start = (const unsigned char*)bytes;
+	traceBuffer.insert(traceBuffer.end(), start, start + size);
+}
+
+static void put16(unsigned short value) { putBytes(&value, sizeof(value)); }
+static void put32(unsigned int value) { putBytes(&value, sizeof(value)); }
+static void put64(unsigned long long value) { putBytes(&value, sizeof(value)); }
+static void putFloat(float value) { putBytes(&value, sizeof(value)); }
+
+static void putBlob(const void* bytes, unsigned int size)
+{
+	put32(size);
+	if (size > 0)
+		putBytes(bytes, size);
+}
+
+// Saved pointers the wrappers forward to
+static PFNGLCLEARPROC realClear;
+static PFNGLCLEARCOLORPROC realClearColor;
+static PFNGLVIEWPORTPROC realViewport;
+static PFNGLENABLEPROC realEnable;
+static PFNGLDISABLEPROC realDisable;
+static PFNGLBLENDFUNCPROC realBlendFunc;
+static PFNGLPOLYGONMODEPROC realPolygonMode;
+static PFNGLGENBUFFERSPROC realGenBuffers;
+static PFNGLDELETEBUFFERSPROC realDeleteBuffers;
+static PFNGLBINDBUFFERPROC realBindBuffer;
+static PFNGLBUFFERDATAPROC realBufferData;
+static PFNGLBUFFERSUBDATAPROC realBufferSubData;
+static PFNGLGENVERTEXARRAYSPROC realGenVertexArrays;
+static PFNGLDELETEVERTEXARRAYSPROC realDeleteVertexArrays;
+static PFNGLBINDVERTEXARRAYPROC realBindVertexArray;
+static PFNGLVERTEXATTRIBPOINTERPROC realVertexAttribPointer;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC realEnableVertexAttribArray;
+static PFNGLCREATESHADERPROC realCreateShader;
+static PFNGLSHADERSOURCEPROC realShaderSource;
+static PFNGLCOMPILESHADERPROC realCompileShader;
+static PFNGLDELETESHADERPROC realDeleteShader;
+static PFNGLCREATEPROGRAMPROC realCreateProgram;
+static PFNGLATTACHSHADERPROC realAttachShader;
+static PFNGLLINKPROGRAMPROC realLinkProgram;
+static PFNGLUSEPROGRAMPROC realUseProgram;
+static PFNGLDELETEPROGRAMPROC realDeleteProgram;
+static PFNGLDRAWARRAYSPROC realDrawArrays;
+static PFNGLDRAWELEMENTSPROC realDrawElements;
+
+static void APIENTRY captureClear(GLbitfield mask)
+{
+	put16(TRACE_CLEAR); put32(mask);
+	realClear(mask);
+}
+
+static void APIENTRY captureClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	put16(TRACE_CLEAR_COLOR); putFloat(red); putFloat(green); putFloat(blue); putFloat(alpha);
+	realClearColor(red, green, blue, alpha);
+}
+
+static void APIENTRY captureViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	put16(TRACE_VIEWPORT); put32(x); put32(y); put32(width); put32(height);
+	realViewport(x, y, width, height);
+}
+
+static void APIENTRY captureEnable(GLenum cap)
+{
+	put16(TRACE_ENABLE); put32(cap);
+	realEnable(cap);
+}
+
+static void APIENTRY captureDisable(GLenum cap)
+{
+	put16(TRACE_DISABLE); put32(cap);
+	realDisable(cap);
+}
+
+static void APIENTRY captureBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	put16(TRACE_BLEND_FUNC); put32(sfactor); put32(dfactor);
+	realBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY capturePolygonMode(GLenum face, GLenum mode)
+{
+	put16(TRACE_POLYGON_MODE); put32(face); put32(mode);
+	realPolygonMode(face, mode);
+}
+
+static void APIENTRY captureGenBuffers(GLsizei n, GLuint* buffers)
+{
+	realGenBuffers(n, buffers);
+	put16(TRACE_GEN_BUFFERS); putBlob(buffers, n * sizeof(GLuint));
+}
+
+static void APIENTRY captureDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+	put16(TRACE_DELETE_BUFFERS); putBlob(buffers, n * sizeof(GLuint));
+	realDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY captureBindBuffer(GLenum target, GLuint buffer)
+{
+	put16(TRACE_BIND_BUFFER); put32(target); put32(buffer);
+	realBindBuffer(target, buffer);
+}
+
+static void APIENTRY captureBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+	// A NULL upload (orphaning) is recorded as an empty blob
+	put16(TRACE_BUFFER_DATA); put32(target); put32(usage); put64(size);
+	putBlob(data, data != NULL ? (unsigned int)size : 0);
+	realBufferData(target, size, data, usage);
+}
+
+static void APIENTRY captureBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	put16(TRACE_BUFFER_SUB_DATA); put32(target); put64(offset); putBlob(data, (unsigned int)size);
+	realBufferSubData(target, offset, size, data);
+}
+
+static void APIENTRY captureGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+	realGenVertexArrays(n, arrays);
+	put16(TRACE_GEN_VERTEX_ARRAYS); putBlob(arrays, n * sizeof(GLuint));
+}
+
+static void APIENTRY captureDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+	put16(TRACE_DELETE_VERTEX_ARRAYS); putBlob(arrays, n * sizeof(GLuint));
+	realDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY captureBindVertexArray(GLuint array)
+{
+	put16(TRACE_BIND_VERTEX_ARRAY); put32(array);
+	realBindVertexArray(array);
+}
+
+static void APIENTRY captureVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+	// Core profile sources attributes from the bound buffer, so pointer is an offset
+	put16(TRACE_VERTEX_ATTRIB_POINTER); put32(index); put32(size); put32(type); put32(normalized); put32(stride);
+	put64((unsigned long long)(size_t)pointer);
+	realVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY captureEnableVertexAttribArray(GLuint index)
+{
+	put16(TRACE_ENABLE_VERTEX_ATTRIB_ARRAY); put32(index);
+	realEnableVertexAttribArray(index);
+}
+
+static GLuint APIENTRY captureCreateShader(GLenum type)
+{
+	GLuint shader = realCreateShader(type);
+	put16(TRACE_CREATE_SHADER); put32(type); put32(shader);
+	return shader;
+}
+
+static void APIENTRY captureShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+	// All strings are joined into one source blob
+	std::string source;
+	for (GLsizei i = 0; i < count; i++)
+	{
+		if (length != NULL && length[i] >= 0)
+			source.append(string[i], length[i]);
+		else
+			source.append(string[i]);
+	}
+
+	put16(TRACE_SHADER_SOURCE); put32(shader); putBlob(source.data(), (unsigned int)source.size());
+	realShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY captureCompileShader(GLuint shader)
+{
+	put16(TRACE_COMPILE_SHADER); put32(shader);
+	realCompileShader(shader);
+}
+
+static void APIENTRY captureDeleteShader(GLuint shader)
+{
+	put16(TRACE_DELETE_SHADER); put32(shader);
+	realDeleteShader(shader);
+}
+
+static GLuint APIENTRY captureCreateProgram()
+{
+	GLuint program = realCreateProgram();
+	put16(TRACE_CREATE_PROGRAM); put32(program);
+	return program;
+}
+
+static void APIENTRY captureAttachShader(GLuint program, GLuint shader)
+{
+	put16(TRACE_ATTACH_SHADER); put32(program); put32(shader);
+	realAttachShader(program, shader);
+}
+
+static void APIENTRY captureLinkProgram(GLuint program)
+{
+	put16(TRACE_LINK_PROGRAM); put32(program);
+	realLinkProgram(program);
+}
+
+static void APIENTRY captureUseProgram(GLuint program)
+{
+	put16(TRACE_USE_PROGRAM); put32(program);
+	realUseProgram(program);
+}
+
+static void APIENTRY captureDeleteProgram(GLuint program)
+{
+	put16(TRACE_DELETE_PROGRAM); put32(program);
+	realDeleteProgram(program);
+}
+
+static void APIENTRY captureDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	put16(TRACE_DRAW_ARRAYS); put32(mode); put32(first); put32(count);
+	realDrawArrays(mode, first, count);
+}
+
+static void APIENTRY captureDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+	put16(TRACE_DRAW_ELEMENTS); put32(mode); put32(count); put32(type);
+	put64((unsigned long long)(size_t)indices);
+	realDrawElements(mode, count, type, indices);
+}
+
+// Swap a glad pointer for its wrapper (or back), keeping the original
+#define HOOK(name, type) real##name = (type)gladResolveGLProc("gl" #name); glad_gl##name = capture##name
+#define UNHOOK(name) glad_gl##name = real##name
+
+bool startCapture(const char* path)
+{
+	traceFile = fopen(path, "wb");
+	if (traceFile == NULL)
+	{
+		std::cout << "ERROR::CAPTURE::OPEN_FAILED " << path << std::endl;
+		return false;
+	}
+
+	putBytes("GLTR", 4);
+	put32(TRACE_VERSION);
+
+	HOOK(Clear, PFNGLCLEARPROC);
+	HOOK(ClearColor, PFNGLCLEARCOLORPROC);
+	HOOK(Viewport, PFNGLVIEWPORTPROC);
+	HOOK(Enable, PFNGLENABLEPROC);
+	HOOK(Disable, PFNGLDISABLEPROC);
+	HOOK(BlendFunc, PFNGLBLENDFUNCPROC);
+	HOOK(PolygonMode, PFNGLPOLYGONMODEPROC);
+	HOOK(GenBuffers, PFNGLGENBUFFERSPROC);
+	HOOK(DeleteBuffers, PFNGLDELETEBUFFERSPROC);
+	HOOK(BindBuffer, PFNGLBINDBUFFERPROC);
+	HOOK(BufferData, PFNGLBUFFERDATAPROC);
+	HOOK(BufferSubData, PFNGLBUFFERSUBDATAPROC);
+	HOOK(GenVertexArrays, PFNGLGENVERTEXARRAYSPROC);
+	HOOK(DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
+	HOOK(BindVertexArray, PFNGLBINDVERTEXARRAYPROC);
+	HOOK(VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC);
+	HOOK(EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC);
+	HOOK(CreateShader, PFNGLCREATESHADERPROC);
+	HOOK(ShaderSource, PFNGLSHADERSOURCEPROC);
+	HOOK(CompileShader, PFNGLCOMPILESHADERPROC);
+	HOOK(DeleteShader, PFNGLDELETESHADERPROC);
+	HOOK(CreateProgram, PFNGLCREATEPROGRAMPROC);
+	HOOK(AttachShader, PFNGLATTACHSHADERPROC);
+	HOOK(LinkProgram, PFNGLLINKPROGRAMPROC);
+	HOOK(UseProgram, PFNGLUSEPROGRAMPROC);
+	HOOK(DeleteProgram, PFNGLDELETEPROGRAMPROC);
+	HOOK(DrawArrays, PFNGLDRAWARRAYSPROC);
+	HOOK(DrawElements, PFNGLDRAWELEMENTSPROC);
+	return true;
+}
+
+void captureFrameEnd()
+{
+	if (traceFile == NULL)
+		return;
+
+	put16(TRACE_FRAME_END);
+	flushTrace();
+}
+
+void stopCapture()
+{
+	if (traceFile == NULL)
+		return;
+
+	UNHOOK(Clear);
+	UNHOOK(ClearColor);
+	UNHOOK(Viewport);
+	UNHOOK(Enable);
+	UNHOOK(Disable);
+	UNHOOK(BlendFunc);
+	UNHOOK(PolygonMode);
+	UNHOOK(GenBuffers);
+	UNHOOK(DeleteBuffers);
+	UNHOOK(BindBuffer);
+	UNHOOK(BufferData);
+	UNHOOK(BufferSubData);
+	UNHOOK(GenVertexArrays);
+	UNHOOK(DeleteVertexArrays);
+	UNHOOK(BindVertexArray);
+	UNHOOK(VertexAttribPointer);
+	UNHOOK(EnableVertexAttribArray);
+	UNHOOK(CreateShader);
+	UNHOOK(ShaderSource);
+	UNHOOK(CompileShader);
+	UNHOOK(DeleteShader);
+	UNHOOK(CreateProgram);
+	UNHOOK(AttachShader);
+	UNHOOK(LinkProgram);
+	UNHOOK(UseProgram);
+	UNHOOK(DeleteProgram);
+	UNHOOK(DrawArrays);
+	UNHOOK(DrawElements);
+
+	flushTrace();
+	fclose(traceFile);
+	traceFile = NULL;
+}
@@ -0,0 +1,295 @@
+#include "gl_trace.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <glad/glad.h>
+
+// How each opcode's record is laid out after the opcode: this many uint32
+// arguments, then optionally a uint64 offset/size, then optionally a blob
+struct TraceLayout
+{
+	unsigned char args;
+	bool offset;
+	bool blob;
+};
+
+static const TraceLayout traceLayouts[TRACE_OP_COUNT] = {
+	{ 0, false, false }, // unused
+	{ 0, false, false }, // TRACE_FRAME_END
+	{ 1, false, false }, // TRACE_CLEAR
+	{ 4, false, false }, // TRACE_CLEAR_COLOR
+	{ 4, false, false }, // TRACE_VIEWPORT
+	{ 1, false, false }, // TRACE_ENABLE
+	{ 1, false, false }, // TRACE_DISABLE
+	{ 2, false, false }, // TRACE_BLEND_FUNC
+	{ 2, false, false }, // TRACE_POLYGON_MODE
+	{ 0, false, true },  // TRACE_GEN_BUFFERS
+	{ 0, false, true },  // TRACE_DELETE_BUFFERS
+	{ 2, false, false }, // TRACE_BIND_BUFFER
+	{ 2, true, true },   // TRACE_BUFFER_DATA
+	{ 1, true, true },   // TRACE_BUFFER_SUB_DATA
+	{ 0, false, true },  // TRACE_GEN_VERTEX_ARRAYS
+	{ 0, false, true },  // TRACE_DELETE_VERTEX_ARRAYS
+	{ 1, false, false }, // TRACE_BIND_VERTEX_ARRAY
+	{ 5, true, false },  // TRACE_VERTEX_ATTRIB_POINTER
+	{ 1, false, false }, // TRACE_ENABLE_VERTEX_ATTRIB_ARRAY
+	{ 2, false, false }, // TRACE_CREATE_SHADER
+	{ 1, false, true },  // TRACE_SHADER_SOURCE
+	{ 1, false, false }, // TRACE_COMPILE_SHADER
+	{ 1, false, false }, // TRACE_DELETE_SHADER
+	{ 1, false, false }, // TRACE_CREATE_PROGRAM
+	{ 2, false, false }, // TRACE_ATTACH_SHADER
+	{ 1, false, false }, // TRACE_LINK_PROGRAM
+	{ 1, false, false }, // TRACE_USE_PROGRAM
+	{ 1, false, false }, // TRACE_DELETE_PROGRAM
+	{ 3, false, false }, // TRACE_DRAW_ARRAYS
+	{ 3, true, false },  // TRACE_DRAW_ELEMENTS
+};
+
+TraceReplayer::TraceReplayer()
+	: setupEnd(0), frames(0)
+{
+}
+
+bool TraceReplayer::load(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		std::cout << "ERROR::REPLAY::OPEN_FAILED " << path << std::endl;
+		return false;
+	}
+
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	data.resize(size > 0 ? size : 0);
+	size_t read = data.empty() ? 0 : fread(data.data(), 1, data.size(), file);
+	fclose(file);
+
+	unsigned int version = 0;
+	if (read != data.size() || data.size() < 8 || memcmp(data.data(), "GLTR", 4) != 0)
+	{
+		std::cout << "ERROR::REPLAY::NOT_A_TRACE " << path << std::endl;
+		return false;
+	}
+	memcpy(&version, &data[4], 4);
+	if (version != TRACE_VERSION)
+	{
+		std::cout << "ERROR::REPLAY::UNSUPPORTED_VERSION " << version << std::endl;
+		return false;
+	}
+
+	// Decode everything up front so replay is a tight loop over commands
+	commands.clear();
+	setupEnd = 0;
+	frames = 0;
+	size_t position = 8;
+	while (position + 2 <= data.size())
+	{
+		Command command;
+		memset(&command, 0, sizeof(command));
+		memcpy(&command.op, &data[position], 2);
+		position += 2;
+
+		if (command.op == 0 || command.op >= TRACE_OP_COUNT)
+		{
+			std::cout << "ERROR::REPLAY::BAD_OPCODE " << command.op << std::endl;
+			return false;
+		}
+
+		const TraceLayout& layout = traceLayouts[command.op];
+		size_t needed = layout.args * 4 + (layout.offset ? 8 : 0) + (layout.blob ? 4 : 0);
+		if (position + needed > data.size())
+			break;
+
+		memcpy(command.args, &data[position], layout.args * 4);
+		position += layout.args * 4;
+		if (layout.offset)
+		{
+			memcpy(&command.offset, &data[position], 8);
+			position += 8;
+		}
+		if (layout.blob)
+		{
+			memcpy(&command.blobSize, &data[position], 4);
+			position += 4;
+			if (position + command.blobSize > data.size())
+				break;
+			command.blob = &data[position];
+			position += command.blobSize;
+		}
+
+		if (command.op == TRACE_FRAME_END)
+		{
+			if (setupEnd == 0)
+				setupEnd = commands.size() + 1;
+			else
+				frames++;
+		}
+		commands.push_back(command);
+	}
+
+	if (position != data.size())
+		std::cout << "Trace is truncated, replaying the complete records only" << std::endl;
+	return true;
+}
+
+unsigned int& TraceReplayer::mapped(std::vector<unsigned int>& names, unsigned int name)
+{
+	if (name >= names.size())
+		names.resize(name + 1, 0);
+	return names[name];
+}
+
+void TraceReplayer::replaySetup()
+{
+	for (size_t i = 0; i < setupEnd; i++)
+		execute(commands[i]);
+}
+
+int TraceReplayer::replayFrames()
+{
+	for (size_t i = setupEnd; i < commands.size(); i++)
+		execute(commands[i]);
+	return frames;
+}
+
+void TraceReplayer::execute(const Command& command)
+{
+	const unsigned int* a = command.args;
+	unsigned int count = command.blobSize / sizeof(unsigned int);
+	const unsigned int* names = (const unsigned int*)command.blob;
+
+	switch (command.op)
+	{
+	case TRACE_FRAME_END:
+		break;
+	case TRACE_CLEAR:
+		glClear(a[0]);
+		break;
+	case TRACE_CLEAR_COLOR:
+	{
+		float color[4];
+		memcpy(color, a, sizeof(color));
+		glClearColor(color[0], color[1], color[2], color[3]);
+		break;
+	}
+	case TRACE_VIEWPORT:
+		glViewport(a[0], a[1], a[2], a[3]);
+		break;
+	case TRACE_ENABLE:
+		glEnable(a[0]);
+		break;
+	case TRACE_DISABLE:
+		glDisable(a[0]);
+		break;
+	case TRACE_BLEND_FUNC:
+		glBlendFunc(a[0], a[1]);
+		break;
+	case TRACE_POLYGON_MODE:
+		glPolygonMode(a[0], a[1]);
+		break;
+	case TRACE_GEN_BUFFERS:
+		for (unsigned int i = 0; i < count; i++)
+			glGenBuffers(1, &mapped(buffers, names[i]));
+		break;
+	case TRACE_DELETE_BUFFERS:
+		for (unsigned int i = 0; i < count; i++)
+		{
+			glDeleteBuffers(1, &mapped(buffers, names[i]));
+			mapped(buffers, names[i]) = 0;
+		}
+		break;
+	case TRACE_BIND_BUFFER:
+		glBindBuffer(a[0], mapped(buffers, a[1]));
+		break;
+	case TRACE_BUFFER_DATA:
+		glBufferData(a[0], (GLsizeiptr)command.offset, command.blobSize > 0 ? command.blob : NULL, a[1]);
+		break;
+	case TRACE_BUFFER_SUB_DATA:
+		glBufferSubData(a[0], (GLintptr)command.offset, command.blobSize, command.blob);
+		break;
+	case TRACE_GEN_VERTEX_ARRAYS:
+		for (unsigned int i = 0; i < count; i++)
+			glGenVertexArrays(1, &mapped(vertexArrays, names[i]));
+		break;
+	case TRACE_DELETE_VERTEX_ARRAYS:
+		for (unsigned int i = 0; i < count; i++)
+		{
+			glDeleteVertexArrays(1, &mapped(vertexArrays, names[i]));
+			mapped(vertexArrays, names[i]) = 0;
+		}
+		break;
+	case TRACE_BIND_VERTEX_ARRAY:
+		glBindVertexArray(mapped(vertexArrays, a[0]));
+		break;
+	case TRACE_VERTEX_ATTRIB_POINTER:
+		glVertexAttribPointer(a[0], a[1], a[2], (GLboolean)a[3], a[4], (const void*)(size_t)command.offset);
+		break;
+	case TRACE_ENABLE_VERTEX_ATTRIB_ARRAY:
+		glEnableVertexAttribArray(a[0]);
+		break;
+	case TRACE_CREATE_SHADER:
+		mapped(shaders, a[1]) = glCreateShader(a[0]);
+		break;
+	case TRACE_SHADER_SOURCE:
+	{
+		const GLchar* source = (const GLchar*)command.blob;
+		GLint length = command.blobSize;
+		glShaderSource(mapped(shaders, a[0]), 1, &source, &length);
+		break;
+	}
+	case TRACE_COMPILE_SHADER:
+		glCompileShader(mapped(shaders, a[0]));
+		break;
+	case TRACE_DELETE_SHADER:
+		glDeleteShader(mapped(shaders, a[0]));
+		mapped(shaders, a[0]) = 0;
+		break;
+	case TRACE_CREATE_PROGRAM:
+		mapped(programs, a[0]) = glCreateProgram();
+		break;
+	case TRACE_ATTACH_SHADER:
+		glAttachShader(mapped(programs, a[0]), mapped(shaders, a[1]));
+		break;
+	case TRACE_LINK_PROGRAM:
+		glLinkProgram(mapped(programs, a[0]));
+		break;
+	case TRACE_USE_PROGRAM:
+		glUseProgram(mapped(programs, a[0]));
+		break;
+	case TRACE_DELETE_PROGRAM:
+		glDeleteProgram(mapped(programs, a[0]));
+		mapped(programs, a[0]) = 0;
+		break;
+	case TRACE_DRAW_ARRAYS:
+		glDrawArrays(a[0], a[1], a[2]);
+		break;
+	case TRACE_DRAW_ELEMENTS:
+		glDrawElements(a[0], a[1], a[2], (const void*)(size_t)command.offset);
+		break;
+	}
+}
+
+void TraceReplayer::destroy()
+{
+	for (size_t i = 1; i < buffers.size(); i++)
+		if (buffers[i] != 0)
+			glDeleteBuffers(1, &buffers[i]);
+	for (size_t i = 1; i < vertexArrays.size(); i++)
+		if (vertexArrays[i] != 0)
+			glDeleteVertexArrays(1, &vertexArrays[i]);
+	for (size_t i = 1; i < programs.size(); i++)
+		if (programs[i] != 0)
+			glDeleteProgram(programs[i]);
+	for (size_t i = 1; i < shaders.size(); i++)
+		if (shaders[i] != 0)
+			glDeleteShader(shaders[i]);
+
+	buffers.clear();
+	vertexArrays.clear();
+	programs.clear();
+	shaders.clear();
+}
@@ -0,0 +1,109 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <cstddef>
+#include <vector>
+
+// Binary GL command trace, recorded at the glad dispatch layer and replayed
+// without any of the application logic.
+//
+// File layout (native byte order): "GLTR", uint32 version, then records.
+// Each record is a uint16 opcode followed by that opcode's arguments as
+// uint32 values, with 64-bit buffer offsets/sizes and length-prefixed blobs
+// for shader sources and buffer contents. Object names are recorded as the
+// application saw them and remapped on replay.
+//
+// Only the entry points below are recorded; other GL calls pass through
+// untouched, so a trace is only complete for code that sticks to them.
+// The app refuses --capture for its modes that don't.
+enum TraceOp
+{
+	TRACE_FRAME_END = 1,
+	TRACE_CLEAR,
+	TRACE_CLEAR_COLOR,
+	TRACE_VIEWPORT,
+	TRACE_ENABLE,
+	TRACE_DISABLE,
+	TRACE_BLEND_FUNC,
+	TRACE_POLYGON_MODE,
+	TRACE_GEN_BUFFERS,
+	TRACE_DELETE_BUFFERS,
+	TRACE_BIND_BUFFER,
+	TRACE_BUFFER_DATA,
+	TRACE_BUFFER_SUB_DATA,
+	TRACE_GEN_VERTEX_ARRAYS,
+	TRACE_DELETE_VERTEX_ARRAYS,
+	TRACE_BIND_VERTEX_ARRAY,
+	TRACE_VERTEX_ATTRIB_POINTER,
+	TRACE_ENABLE_VERTEX_ATTRIB_ARRAY,
+	TRACE_CREATE_SHADER,
+	TRACE_SHADER_SOURCE,
+	TRACE_COMPILE_SHADER,
+	TRACE_DELETE_SHADER,
+	TRACE_CREATE_PROGRAM,
+	TRACE_ATTACH_SHADER,
+	TRACE_LINK_PROGRAM,
+	TRACE_USE_PROGRAM,
+	TRACE_DELETE_PROGRAM,
+	TRACE_DRAW_ARRAYS,
+	TRACE_DRAW_ELEMENTS,
+	TRACE_OP_COUNT
+};
+
+const unsigned int TRACE_VERSION = 1;
+
+// Capture: hooks the glad pointers of the calls above. GL must be loaded
+// first, and only one context/thread should issue GL while capturing.
+bool startCapture(const char* path);
+void captureFrameEnd();
+void stopCapture();
+
+// Replay of a loaded trace into the current context
+class TraceReplayer
+{
+public:
+	TraceReplayer();
+
+	bool load(const char* path);
+
+	// Everything before the first frame marker (object creation and uploads)
+	void replaySetup();
+
+	// Every recorded frame once, returns the number of frames replayed
+	int replayFrames();
+
+	// Delete the objects the trace created and never deleted itself
+	void destroy();
+
+	size_t commandCount() const { return commands.size(); }
+	// Commands replayFrames() issues, i.e. without the setup
+	size_t frameCommandCount() const { return commands.size() - setupEnd; }
+	int frameCount() const { return frames; }
+
+private:
+	struct Command
+	{
+		unsigned short op;
+		unsigned int args[5];
+		unsigned long long offset;
+		const unsigned char* blob;
+		unsigned int blobSize;
+	};
+
+	void execute(const Command& command);
+
+	unsigned int& mapped(std::vector<unsigned int>& names, unsigned int name);
+
+	std::vector<unsigned char> data;
+	std::vector<Command> commands;
+	size_t setupEnd;
+	int frames;
+
+	// Recorded name -> name in this context, indexed by the recorded name
+	std::vector<unsigned int> buffers;
+	std::vector<unsigned int> vertexArrays;
+	std::vector<unsigned int> shaders;
+	std::vector<unsigned int> programs;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <glad/glad.h>
+#include "glad_ext.h"
 
 static void* get_proc(const char *namez);
 
@@ -165,95 +166,166 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension names live in one arena allocation next to an open-addressing
+ * hash set (FNV-1a, linear probing, at most half full), so a query is a
+ * hash plus usually a single strcmp. The set is kept until the next load
+ * for runtime capability checks through gladHasExtension(). */
+typedef struct {
+    unsigned int hash;
+    unsigned int offset; /* into names, 0 marks an empty slot */
+} glad_ext_slot;
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+typedef struct {
+    void *block;         /* slots followed by the name arena */
+    glad_ext_slot *slots;
+    char *names;
+    unsigned int mask;
+    int count;
+} glad_ext_set;
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+static glad_ext_set exts = { NULL, NULL, NULL, 0, 0 };
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static unsigned int hash_ext(const char *name) {
+    unsigned int hash = 2166136261u;
+    while(*name) {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static void free_exts(glad_ext_set *set) {
+    free(set->block);
+    set->block = NULL;
+    set->slots = NULL;
+    set->names = NULL;
+    set->mask = 0;
+    set->count = 0;
+}
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+/* One block holds a power-of-two slot table for count names and total_len
+ * bytes of names. Offset 0 of the arena is reserved so it can mean empty. */
+static int alloc_exts(glad_ext_set *set, int count, size_t total_len) {
+    unsigned int capacity = 16;
+    size_t slot_bytes;
+
+    while(capacity < (unsigned int)count * 2) capacity <<= 1;
+    slot_bytes = capacity * sizeof(glad_ext_slot);
+
+    set->block = calloc(1, slot_bytes + 1 + total_len);
+    if(set->block == NULL) return 0;
+
+    set->slots = (glad_ext_slot *)set->block;
+    set->names = (char *)set->block + slot_bytes;
+    set->mask = capacity - 1;
+    set->count = 0;
+    return 1;
+}
+
+/* Name must already be in the arena */
+static void insert_ext(glad_ext_set *set, unsigned int offset) {
+    unsigned int hash = hash_ext(set->names + offset);
+    unsigned int index = hash & set->mask;
+
+    while(set->slots[index].offset != 0) {
+        if(set->slots[index].hash == hash &&
+            strcmp(set->names + set->slots[index].offset, set->names + offset) == 0) {
+            return;
         }
+        index = (index + 1) & set->mask;
     }
-#endif
-    return 1;
+    set->slots[index].hash = hash;
+    set->slots[index].offset = offset;
+    set->count++;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
+static int find_ext(const glad_ext_set *set, const char *ext) {
+    unsigned int hash, index;
+
+    if(set->slots == NULL || ext == NULL) return 0;
+
+    hash = hash_ext(ext);
+    index = hash & set->mask;
+    while(set->slots[index].offset != 0) {
+        if(set->slots[index].hash == hash &&
+            strcmp(set->names + set->slots[index].offset, ext) == 0) {
+            return 1;
         }
-        free((void *)exts_i);
-        exts_i = NULL;
+        index = (index + 1) & set->mask;
     }
+    return 0;
 }
 
-static int has_ext(const char *ext) {
+/* Takes the query functions explicitly so per-context tables can use it too */
+static int get_exts(glad_ext_set *set, int major, PFNGLGETSTRINGPROC get_string,
+    PFNGLGETINTEGERVPROC get_integerv, PFNGLGETSTRINGIPROC get_stringi) {
+    free_exts(set);
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3 || get_stringi == NULL) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
+        /* One space separated string, copy it and split it in place */
+        const char *all = (const char *)get_string(GL_EXTENSIONS);
+        size_t len, start, index;
+        int count = 1;
+
+        if(all == NULL) return 0;
+        len = strlen(all);
+        for(index = 0; index < len; index++) {
+            if(all[index] == ' ') count++;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
+        if(!alloc_exts(set, count, len + 1)) return 0;
+        memcpy(set->names + 1, all, len + 1);
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        start = 1;
+        for(index = 1; index <= len + 1; index++) {
+            if(set->names[index] == ' ' || set->names[index] == '\0') {
+                set->names[index] = '\0';
+                if(index > start) insert_ext(set, (unsigned int)start);
+                start = index + 1;
             }
-            extensions = terminator;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
+        /* Driver strings stay valid for the context lifetime, so remember
+         * them once to size the arena and then copy them all into it */
+        int num_exts_i = 0;
+        const char **strs;
+        size_t total_len = 0, offset = 1;
         int index;
-        if(exts_i == NULL) return 0;
+
+        get_integerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i <= 0) return alloc_exts(set, 0, 0);
+
+        strs = (const char **)malloc((size_t)num_exts_i * sizeof(*strs));
+        if(strs == NULL) return 0;
+
         for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+            strs[index] = (const char *)get_stringi(GL_EXTENSIONS, (unsigned)index);
+            if(strs[index] != NULL) total_len += strlen(strs[index]) + 1;
+        }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+        if(!alloc_exts(set, num_exts_i, total_len)) {
+            free((void *)strs);
+            return 0;
         }
+
+        for(index = 0; index < num_exts_i; index++) {
+            size_t len;
+            if(strs[index] == NULL) continue;
+            len = strlen(strs[index]) + 1;
+            memcpy(set->names + offset, strs[index], len);
+            insert_ext(set, (unsigned int)offset);
+            offset += len;
+        }
+        free((void *)strs);
     }
 #endif
+    return 1;
+}
 
-    return 0;
+static int has_ext(const char *ext) {
+    return find_ext(&exts, ext);
 }
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
@@ -2433,21 +2505,18 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
 }
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	if (!get_exts(&exts, max_loaded_major, glad_glGetString, glad_glGetIntegerv, glad_glGetStringi)) return 0;
 	return 1;
 }
 
-static void find_coreGL(void) {
+static int parse_version(const char *version, int *major, int *minor) {
 
     /* Thank you @elmindreda
      * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
      * https://github.com/glfw/glfw/blob/master/src/context.c#L36
      */
-    int i, major, minor;
+    int i;
 
-    const char* version;
     const char* prefixes[] = {
         "OpenGL ES-CM ",
         "OpenGL ES-CL ",
@@ -2455,8 +2524,8 @@ static void find_coreGL(void) {
         NULL
     };
 
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
+    *major = 0; *minor = 0;
+    if (!version) return 0;
 
     for (i = 0;  prefixes[i];  i++) {
         const size_t length = strlen(prefixes[i]);
@@ -2468,10 +2537,17 @@ static void find_coreGL(void) {
 
 /* PR #18 */
 #ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
+    sscanf_s(version, "%d.%d", major, minor);
 #else
-    sscanf(version, "%d.%d", &major, &minor);
+    sscanf(version, "%d.%d", major, minor);
 #endif
+    return 1;
+}
+
+static void find_coreGL(void) {
+    int major, minor;
+
+    if (!parse_version((const char*) glGetString(GL_VERSION), &major, &minor)) return;
 
     GLVersion.major = major; GLVersion.minor = minor;
     max_loaded_major = major; max_loaded_minor = minor;
@@ -2500,6 +2576,9 @@ static void find_coreGL(void) {
 	}
 }
 
+/* Loader of the last successful load call, see gladGetExtensionProc() */
+static GLADloadproc glad_last_loader = NULL;
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
@@ -2527,6 +2606,1476 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_6(load);
 
 	if (!find_extensionsGL()) return 0;
+	glad_last_loader = load;
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+
+/* Every entry point with the GL version that introduced it, sorted by name.
+ * Used by the lazy loader to find the slot a trampoline has to patch. */
+typedef struct {
+    const char *name;
+    void **proc;
+    int version;
+} glad_proc_entry;
+
+#define GLAD_PROC_COUNT 1048
+
+static int *const glad_version_flags[] = {
+    &GLAD_GL_VERSION_1_0,
+    &GLAD_GL_VERSION_1_1,
+    &GLAD_GL_VERSION_1_2,
+    &GLAD_GL_VERSION_1_3,
+    &GLAD_GL_VERSION_1_4,
+    &GLAD_GL_VERSION_1_5,
+    &GLAD_GL_VERSION_2_0,
+    &GLAD_GL_VERSION_2_1,
+    &GLAD_GL_VERSION_3_0,
+    &GLAD_GL_VERSION_3_1,
+    &GLAD_GL_VERSION_3_2,
+    &GLAD_GL_VERSION_3_3,
+    &GLAD_GL_VERSION_4_0,
+    &GLAD_GL_VERSION_4_1,
+    &GLAD_GL_VERSION_4_2,
+    &GLAD_GL_VERSION_4_3,
+    &GLAD_GL_VERSION_4_4,
+    &GLAD_GL_VERSION_4_5,
+    &GLAD_GL_VERSION_4_6
+};
+
+/* Same versions as major * 10 + minor, for per-context version checks */
+#define GLAD_VERSION_COUNT 19
+
+static const int glad_version_numbers[GLAD_VERSION_COUNT] = {
+    10, 11, 12, 13, 14, 15, 20, 21, 30, 31, 32, 33, 40, 41, 42, 43, 44, 45, 46
+};
+
+static const glad_proc_entry glad_proc_table[GLAD_PROC_COUNT] = {
+    {"glAccum", (void**)&glad_glAccum, 0},
+    {"glActiveShaderProgram", (void**)&glad_glActiveShaderProgram, 13},
+    {"glActiveTexture", (void**)&glad_glActiveTexture, 3},
+    {"glAlphaFunc", (void**)&glad_glAlphaFunc, 0},
+    {"glAreTexturesResident", (void**)&glad_glAreTexturesResident, 1},
+    {"glArrayElement", (void**)&glad_glArrayElement, 1},
+    {"glAttachShader", (void**)&glad_glAttachShader, 6},
+    {"glBegin", (void**)&glad_glBegin, 0},
+    {"glBeginConditionalRender", (void**)&glad_glBeginConditionalRender, 8},
+    {"glBeginQuery", (void**)&glad_glBeginQuery, 5},
+    {"glBeginQueryIndexed", (void**)&glad_glBeginQueryIndexed, 12},
+    {"glBeginTransformFeedback", (void**)&glad_glBeginTransformFeedback, 8},
+    {"glBindAttribLocation", (void**)&glad_glBindAttribLocation, 6},
+    {"glBindBuffer", (void**)&glad_glBindBuffer, 5},
+    {"glBindBufferBase", (void**)&glad_glBindBufferBase, 8},
+    {"glBindBufferRange", (void**)&glad_glBindBufferRange, 8},
+    {"glBindBuffersBase", (void**)&glad_glBindBuffersBase, 16},
+    {"glBindBuffersRange", (void**)&glad_glBindBuffersRange, 16},
+    {"glBindFragDataLocation", (void**)&glad_glBindFragDataLocation, 8},
+    {"glBindFragDataLocationIndexed", (void**)&glad_glBindFragDataLocationIndexed, 11},
+    {"glBindFramebuffer", (void**)&glad_glBindFramebuffer, 8},
+    {"glBindImageTexture", (void**)&glad_glBindImageTexture, 14},
+    {"glBindImageTextures", (void**)&glad_glBindImageTextures, 16},
+    {"glBindProgramPipeline", (void**)&glad_glBindProgramPipeline, 13},
+    {"glBindRenderbuffer", (void**)&glad_glBindRenderbuffer, 8},
+    {"glBindSampler", (void**)&glad_glBindSampler, 11},
+    {"glBindSamplers", (void**)&glad_glBindSamplers, 16},
+    {"glBindTexture", (void**)&glad_glBindTexture, 1},
+    {"glBindTextureUnit", (void**)&glad_glBindTextureUnit, 17},
+    {"glBindTextures", (void**)&glad_glBindTextures, 16},
+    {"glBindTransformFeedback", (void**)&glad_glBindTransformFeedback, 12},
+    {"glBindVertexArray", (void**)&glad_glBindVertexArray, 8},
+    {"glBindVertexBuffer", (void**)&glad_glBindVertexBuffer, 15},
+    {"glBindVertexBuffers", (void**)&glad_glBindVertexBuffers, 16},
+    {"glBitmap", (void**)&glad_glBitmap, 0},
+    {"glBlendColor", (void**)&glad_glBlendColor, 4},
+    {"glBlendEquation", (void**)&glad_glBlendEquation, 4},
+    {"glBlendEquationSeparate", (void**)&glad_glBlendEquationSeparate, 6},
+    {"glBlendEquationSeparatei", (void**)&glad_glBlendEquationSeparatei, 12},
+    {"glBlendEquationi", (void**)&glad_glBlendEquationi, 12},
+    {"glBlendFunc", (void**)&glad_glBlendFunc, 0},
+    {"glBlendFuncSeparate", (void**)&glad_glBlendFuncSeparate, 4},
+    {"glBlendFuncSeparatei", (void**)&glad_glBlendFuncSeparatei, 12},
+    {"glBlendFunci", (void**)&glad_glBlendFunci, 12},
+    {"glBlitFramebuffer", (void**)&glad_glBlitFramebuffer, 8},
+    {"glBlitNamedFramebuffer", (void**)&glad_glBlitNamedFramebuffer, 17},
+    {"glBufferData", (void**)&glad_glBufferData, 5},
+    {"glBufferStorage", (void**)&glad_glBufferStorage, 16},
+    {"glBufferSubData", (void**)&glad_glBufferSubData, 5},
+    {"glCallList", (void**)&glad_glCallList, 0},
+    {"glCallLists", (void**)&glad_glCallLists, 0},
+    {"glCheckFramebufferStatus", (void**)&glad_glCheckFramebufferStatus, 8},
+    {"glCheckNamedFramebufferStatus", (void**)&glad_glCheckNamedFramebufferStatus, 17},
+    {"glClampColor", (void**)&glad_glClampColor, 8},
+    {"glClear", (void**)&glad_glClear, 0},
+    {"glClearAccum", (void**)&glad_glClearAccum, 0},
+    {"glClearBufferData", (void**)&glad_glClearBufferData, 15},
+    {"glClearBufferSubData", (void**)&glad_glClearBufferSubData, 15},
+    {"glClearBufferfi", (void**)&glad_glClearBufferfi, 8},
+    {"glClearBufferfv", (void**)&glad_glClearBufferfv, 8},
+    {"glClearBufferiv", (void**)&glad_glClearBufferiv, 8},
+    {"glClearBufferuiv", (void**)&glad_glClearBufferuiv, 8},
+    {"glClearColor", (void**)&glad_glClearColor, 0},
+    {"glClearDepth", (void**)&glad_glClearDepth, 0},
+    {"glClearDepthf", (void**)&glad_glClearDepthf, 13},
+    {"glClearIndex", (void**)&glad_glClearIndex, 0},
+    {"glClearNamedBufferData", (void**)&glad_glClearNamedBufferData, 17},
+    {"glClearNamedBufferSubData", (void**)&glad_glClearNamedBufferSubData, 17},
+    {"glClearNamedFramebufferfi", (void**)&glad_glClearNamedFramebufferfi, 17},
+    {"glClearNamedFramebufferfv", (void**)&glad_glClearNamedFramebufferfv, 17},
+    {"glClearNamedFramebufferiv", (void**)&glad_glClearNamedFramebufferiv, 17},
+    {"glClearNamedFramebufferuiv", (void**)&glad_glClearNamedFramebufferuiv, 17},
+    {"glClearStencil", (void**)&glad_glClearStencil, 0},
+    {"glClearTexImage", (void**)&glad_glClearTexImage, 16},
+    {"glClearTexSubImage", (void**)&glad_glClearTexSubImage, 16},
+    {"glClientActiveTexture", (void**)&glad_glClientActiveTexture, 3},
+    {"glClientWaitSync", (void**)&glad_glClientWaitSync, 10},
+    {"glClipControl", (void**)&glad_glClipControl, 17},
+    {"glClipPlane", (void**)&glad_glClipPlane, 0},
+    {"glColor3b", (void**)&glad_glColor3b, 0},
+    {"glColor3bv", (void**)&glad_glColor3bv, 0},
+    {"glColor3d", (void**)&glad_glColor3d, 0},
+    {"glColor3dv", (void**)&glad_glColor3dv, 0},
+    {"glColor3f", (void**)&glad_glColor3f, 0},
+    {"glColor3fv", (void**)&glad_glColor3fv, 0},
+    {"glColor3i", (void**)&glad_glColor3i, 0},
+    {"glColor3iv", (void**)&glad_glColor3iv, 0},
+    {"glColor3s", (void**)&glad_glColor3s, 0},
+    {"glColor3sv", (void**)&glad_glColor3sv, 0},
+    {"glColor3ub", (void**)&glad_glColor3ub, 0},
+    {"glColor3ubv", (void**)&glad_glColor3ubv, 0},
+    {"glColor3ui", (void**)&glad_glColor3ui, 0},
+    {"glColor3uiv", (void**)&glad_glColor3uiv, 0},
+    {"glColor3us", (void**)&glad_glColor3us, 0},
+    {"glColor3usv", (void**)&glad_glColor3usv, 0},
+    {"glColor4b", (void**)&glad_glColor4b, 0},
+    {"glColor4bv", (void**)&glad_glColor4bv, 0},
+    {"glColor4d", (void**)&glad_glColor4d, 0},
+    {"glColor4dv", (void**)&glad_glColor4dv, 0},
+    {"glColor4f", (void**)&glad_glColor4f, 0},
+    {"glColor4fv", (void**)&glad_glColor4fv, 0},
+    {"glColor4i", (void**)&glad_glColor4i, 0},
+    {"glColor4iv", (void**)&glad_glColor4iv, 0},
+    {"glColor4s", (void**)&glad_glColor4s, 0},
+    {"glColor4sv", (void**)&glad_glColor4sv, 0},
+    {"glColor4ub", (void**)&glad_glColor4ub, 0},
+    {"glColor4ubv", (void**)&glad_glColor4ubv, 0},
+    {"glColor4ui", (void**)&glad_glColor4ui, 0},
+    {"glColor4uiv", (void**)&glad_glColor4uiv, 0},
+    {"glColor4us", (void**)&glad_glColor4us, 0},
+    {"glColor4usv", (void**)&glad_glColor4usv, 0},
+    {"glColorMask", (void**)&glad_glColorMask, 0},
+    {"glColorMaski", (void**)&glad_glColorMaski, 8},
+    {"glColorMaterial", (void**)&glad_glColorMaterial, 0},
+    {"glColorP3ui", (void**)&glad_glColorP3ui, 11},
+    {"glColorP3uiv", (void**)&glad_glColorP3uiv, 11},
+    {"glColorP4ui", (void**)&glad_glColorP4ui, 11},
+    {"glColorP4uiv", (void**)&glad_glColorP4uiv, 11},
+    {"glColorPointer", (void**)&glad_glColorPointer, 1},
+    {"glCompileShader", (void**)&glad_glCompileShader, 6},
+    {"glCompressedTexImage1D", (void**)&glad_glCompressedTexImage1D, 3},
+    {"glCompressedTexImage2D", (void**)&glad_glCompressedTexImage2D, 3},
+    {"glCompressedTexImage3D", (void**)&glad_glCompressedTexImage3D, 3},
+    {"glCompressedTexSubImage1D", (void**)&glad_glCompressedTexSubImage1D, 3},
+    {"glCompressedTexSubImage2D", (void**)&glad_glCompressedTexSubImage2D, 3},
+    {"glCompressedTexSubImage3D", (void**)&glad_glCompressedTexSubImage3D, 3},
+    {"glCompressedTextureSubImage1D", (void**)&glad_glCompressedTextureSubImage1D, 17},
+    {"glCompressedTextureSubImage2D", (void**)&glad_glCompressedTextureSubImage2D, 17},
+    {"glCompressedTextureSubImage3D", (void**)&glad_glCompressedTextureSubImage3D, 17},
+    {"glCopyBufferSubData", (void**)&glad_glCopyBufferSubData, 9},
+    {"glCopyImageSubData", (void**)&glad_glCopyImageSubData, 15},
+    {"glCopyNamedBufferSubData", (void**)&glad_glCopyNamedBufferSubData, 17},
+    {"glCopyPixels", (void**)&glad_glCopyPixels, 0},
+    {"glCopyTexImage1D", (void**)&glad_glCopyTexImage1D, 1},
+    {"glCopyTexImage2D", (void**)&glad_glCopyTexImage2D, 1},
+    {"glCopyTexSubImage1D", (void**)&glad_glCopyTexSubImage1D, 1},
+    {"glCopyTexSubImage2D", (void**)&glad_glCopyTexSubImage2D, 1},
+    {"glCopyTexSubImage3D", (void**)&glad_glCopyTexSubImage3D, 2},
+    {"glCopyTextureSubImage1D", (void**)&glad_glCopyTextureSubImage1D, 17},
+    {"glCopyTextureSubImage2D", (void**)&glad_glCopyTextureSubImage2D, 17},
+    {"glCopyTextureSubImage3D", (void**)&glad_glCopyTextureSubImage3D, 17},
+    {"glCreateBuffers", (void**)&glad_glCreateBuffers, 17},
+    {"glCreateFramebuffers", (void**)&glad_glCreateFramebuffers, 17},
+    {"glCreateProgram", (void**)&glad_glCreateProgram, 6},
+    {"glCreateProgramPipelines", (void**)&glad_glCreateProgramPipelines, 17},
+    {"glCreateQueries", (void**)&glad_glCreateQueries, 17},
+    {"glCreateRenderbuffers", (void**)&glad_glCreateRenderbuffers, 17},
+    {"glCreateSamplers", (void**)&glad_glCreateSamplers, 17},
+    {"glCreateShader", (void**)&glad_glCreateShader, 6},
+    {"glCreateShaderProgramv", (void**)&glad_glCreateShaderProgramv, 13},
+    {"glCreateTextures", (void**)&glad_glCreateTextures, 17},
+    {"glCreateTransformFeedbacks", (void**)&glad_glCreateTransformFeedbacks, 17},
+    {"glCreateVertexArrays", (void**)&glad_glCreateVertexArrays, 17},
+    {"glCullFace", (void**)&glad_glCullFace, 0},
+    {"glDebugMessageCallback", (void**)&glad_glDebugMessageCallback, 15},
+    {"glDebugMessageControl", (void**)&glad_glDebugMessageControl, 15},
+    {"glDebugMessageInsert", (void**)&glad_glDebugMessageInsert, 15},
+    {"glDeleteBuffers", (void**)&glad_glDeleteBuffers, 5},
+    {"glDeleteFramebuffers", (void**)&glad_glDeleteFramebuffers, 8},
+    {"glDeleteLists", (void**)&glad_glDeleteLists, 0},
+    {"glDeleteProgram", (void**)&glad_glDeleteProgram, 6},
+    {"glDeleteProgramPipelines", (void**)&glad_glDeleteProgramPipelines, 13},
+    {"glDeleteQueries", (void**)&glad_glDeleteQueries, 5},
+    {"glDeleteRenderbuffers", (void**)&glad_glDeleteRenderbuffers, 8},
+    {"glDeleteSamplers", (void**)&glad_glDeleteSamplers, 11},
+    {"glDeleteShader", (void**)&glad_glDeleteShader, 6},
+    {"glDeleteSync", (void**)&glad_glDeleteSync, 10},
+    {"glDeleteTextures", (void**)&glad_glDeleteTextures, 1},
+    {"glDeleteTransformFeedbacks", (void**)&glad_glDeleteTransformFeedbacks, 12},
+    {"glDeleteVertexArrays", (void**)&glad_glDeleteVertexArrays, 8},
+    {"glDepthFunc", (void**)&glad_glDepthFunc, 0},
+    {"glDepthMask", (void**)&glad_glDepthMask, 0},
+    {"glDepthRange", (void**)&glad_glDepthRange, 0},
+    {"glDepthRangeArrayv", (void**)&glad_glDepthRangeArrayv, 13},
+    {"glDepthRangeIndexed", (void**)&glad_glDepthRangeIndexed, 13},
+    {"glDepthRangef", (void**)&glad_glDepthRangef, 13},
+    {"glDetachShader", (void**)&glad_glDetachShader, 6},
+    {"glDisable", (void**)&glad_glDisable, 0},
+    {"glDisableClientState", (void**)&glad_glDisableClientState, 1},
+    {"glDisableVertexArrayAttrib", (void**)&glad_glDisableVertexArrayAttrib, 17},
+    {"glDisableVertexAttribArray", (void**)&glad_glDisableVertexAttribArray, 6},
+    {"glDisablei", (void**)&glad_glDisablei, 8},
+    {"glDispatchCompute", (void**)&glad_glDispatchCompute, 15},
+    {"glDispatchComputeIndirect", (void**)&glad_glDispatchComputeIndirect, 15},
+    {"glDrawArrays", (void**)&glad_glDrawArrays, 1},
+    {"glDrawArraysIndirect", (void**)&glad_glDrawArraysIndirect, 12},
+    {"glDrawArraysInstanced", (void**)&glad_glDrawArraysInstanced, 9},
+    {"glDrawArraysInstancedBaseInstance", (void**)&glad_glDrawArraysInstancedBaseInstance, 14},
+    {"glDrawBuffer", (void**)&glad_glDrawBuffer, 0},
+    {"glDrawBuffers", (void**)&glad_glDrawBuffers, 6},
+    {"glDrawElements", (void**)&glad_glDrawElements, 1},
+    {"glDrawElementsBaseVertex", (void**)&glad_glDrawElementsBaseVertex, 10},
+    {"glDrawElementsIndirect", (void**)&glad_glDrawElementsIndirect, 12},
+    {"glDrawElementsInstanced", (void**)&glad_glDrawElementsInstanced, 9},
+    {"glDrawElementsInstancedBaseInstance", (void**)&glad_glDrawElementsInstancedBaseInstance, 14},
+    {"glDrawElementsInstancedBaseVertex", (void**)&glad_glDrawElementsInstancedBaseVertex, 10},
+    {"glDrawElementsInstancedBaseVertexBaseInstance", (void**)&glad_glDrawElementsInstancedBaseVertexBaseInstance, 14},
+    {"glDrawPixels", (void**)&glad_glDrawPixels, 0},
+    {"glDrawRangeElements", (void**)&glad_glDrawRangeElements, 2},
+    {"glDrawRangeElementsBaseVertex", (void**)&glad_glDrawRangeElementsBaseVertex, 10},
+    {"glDrawTransformFeedback", (void**)&glad_glDrawTransformFeedback, 12},
+    {"glDrawTransformFeedbackInstanced", (void**)&glad_glDrawTransformFeedbackInstanced, 14},
+    {"glDrawTransformFeedbackStream", (void**)&glad_glDrawTransformFeedbackStream, 12},
+    {"glDrawTransformFeedbackStreamInstanced", (void**)&glad_glDrawTransformFeedbackStreamInstanced, 14},
+    {"glEdgeFlag", (void**)&glad_glEdgeFlag, 0},
+    {"glEdgeFlagPointer", (void**)&glad_glEdgeFlagPointer, 1},
+    {"glEdgeFlagv", (void**)&glad_glEdgeFlagv, 0},
+    {"glEnable", (void**)&glad_glEnable, 0},
+    {"glEnableClientState", (void**)&glad_glEnableClientState, 1},
+    {"glEnableVertexArrayAttrib", (void**)&glad_glEnableVertexArrayAttrib, 17},
+    {"glEnableVertexAttribArray", (void**)&glad_glEnableVertexAttribArray, 6},
+    {"glEnablei", (void**)&glad_glEnablei, 8},
+    {"glEnd", (void**)&glad_glEnd, 0},
+    {"glEndConditionalRender", (void**)&glad_glEndConditionalRender, 8},
+    {"glEndList", (void**)&glad_glEndList, 0},
+    {"glEndQuery", (void**)&glad_glEndQuery, 5},
+    {"glEndQueryIndexed", (void**)&glad_glEndQueryIndexed, 12},
+    {"glEndTransformFeedback", (void**)&glad_glEndTransformFeedback, 8},
+    {"glEvalCoord1d", (void**)&glad_glEvalCoord1d, 0},
+    {"glEvalCoord1dv", (void**)&glad_glEvalCoord1dv, 0},
+    {"glEvalCoord1f", (void**)&glad_glEvalCoord1f, 0},
+    {"glEvalCoord1fv", (void**)&glad_glEvalCoord1fv, 0},
+    {"glEvalCoord2d", (void**)&glad_glEvalCoord2d, 0},
+    {"glEvalCoord2dv", (void**)&glad_glEvalCoord2dv, 0},
+    {"glEvalCoord2f", (void**)&glad_glEvalCoord2f, 0},
+    {"glEvalCoord2fv", (void**)&glad_glEvalCoord2fv, 0},
+    {"glEvalMesh1", (void**)&glad_glEvalMesh1, 0},
+    {"glEvalMesh2", (void**)&glad_glEvalMesh2, 0},
+    {"glEvalPoint1", (void**)&glad_glEvalPoint1, 0},
+    {"glEvalPoint2", (void**)&glad_glEvalPoint2, 0},
+    {"glFeedbackBuffer", (void**)&glad_glFeedbackBuffer, 0},
+    {"glFenceSync", (void**)&glad_glFenceSync, 10},
+    {"glFinish", (void**)&glad_glFinish, 0},
+    {"glFlush", (void**)&glad_glFlush, 0},
+    {"glFlushMappedBufferRange", (void**)&glad_glFlushMappedBufferRange, 8},
+    {"glFlushMappedNamedBufferRange", (void**)&glad_glFlushMappedNamedBufferRange, 17},
+    {"glFogCoordPointer", (void**)&glad_glFogCoordPointer, 4},
+    {"glFogCoordd", (void**)&glad_glFogCoordd, 4},
+    {"glFogCoorddv", (void**)&glad_glFogCoorddv, 4},
+    {"glFogCoordf", (void**)&glad_glFogCoordf, 4},
+    {"glFogCoordfv", (void**)&glad_glFogCoordfv, 4},
+    {"glFogf", (void**)&glad_glFogf, 0},
+    {"glFogfv", (void**)&glad_glFogfv, 0},
+    {"glFogi", (void**)&glad_glFogi, 0},
+    {"glFogiv", (void**)&glad_glFogiv, 0},
+    {"glFramebufferParameteri", (void**)&glad_glFramebufferParameteri, 15},
+    {"glFramebufferRenderbuffer", (void**)&glad_glFramebufferRenderbuffer, 8},
+    {"glFramebufferTexture", (void**)&glad_glFramebufferTexture, 10},
+    {"glFramebufferTexture1D", (void**)&glad_glFramebufferTexture1D, 8},
+    {"glFramebufferTexture2D", (void**)&glad_glFramebufferTexture2D, 8},
+    {"glFramebufferTexture3D", (void**)&glad_glFramebufferTexture3D, 8},
+    {"glFramebufferTextureLayer", (void**)&glad_glFramebufferTextureLayer, 8},
+    {"glFrontFace", (void**)&glad_glFrontFace, 0},
+    {"glFrustum", (void**)&glad_glFrustum, 0},
+    {"glGenBuffers", (void**)&glad_glGenBuffers, 5},
+    {"glGenFramebuffers", (void**)&glad_glGenFramebuffers, 8},
+    {"glGenLists", (void**)&glad_glGenLists, 0},
+    {"glGenProgramPipelines", (void**)&glad_glGenProgramPipelines, 13},
+    {"glGenQueries", (void**)&glad_glGenQueries, 5},
+    {"glGenRenderbuffers", (void**)&glad_glGenRenderbuffers, 8},
+    {"glGenSamplers", (void**)&glad_glGenSamplers, 11},
+    {"glGenTextures", (void**)&glad_glGenTextures, 1},
+    {"glGenTransformFeedbacks", (void**)&glad_glGenTransformFeedbacks, 12},
+    {"glGenVertexArrays", (void**)&glad_glGenVertexArrays, 8},
+    {"glGenerateMipmap", (void**)&glad_glGenerateMipmap, 8},
+    {"glGenerateTextureMipmap", (void**)&glad_glGenerateTextureMipmap, 17},
+    {"glGetActiveAtomicCounterBufferiv", (void**)&glad_glGetActiveAtomicCounterBufferiv, 14},
+    {"glGetActiveAttrib", (void**)&glad_glGetActiveAttrib, 6},
+    {"glGetActiveSubroutineName", (void**)&glad_glGetActiveSubroutineName, 12},
+    {"glGetActiveSubroutineUniformName", (void**)&glad_glGetActiveSubroutineUniformName, 12},
+    {"glGetActiveSubroutineUniformiv", (void**)&glad_glGetActiveSubroutineUniformiv, 12},
+    {"glGetActiveUniform", (void**)&glad_glGetActiveUniform, 6},
+    {"glGetActiveUniformBlockName", (void**)&glad_glGetActiveUniformBlockName, 9},
+    {"glGetActiveUniformBlockiv", (void**)&glad_glGetActiveUniformBlockiv, 9},
+    {"glGetActiveUniformName", (void**)&glad_glGetActiveUniformName, 9},
+    {"glGetActiveUniformsiv", (void**)&glad_glGetActiveUniformsiv, 9},
+    {"glGetAttachedShaders", (void**)&glad_glGetAttachedShaders, 6},
+    {"glGetAttribLocation", (void**)&glad_glGetAttribLocation, 6},
+    {"glGetBooleani_v", (void**)&glad_glGetBooleani_v, 8},
+    {"glGetBooleanv", (void**)&glad_glGetBooleanv, 0},
+    {"glGetBufferParameteri64v", (void**)&glad_glGetBufferParameteri64v, 10},
+    {"glGetBufferParameteriv", (void**)&glad_glGetBufferParameteriv, 5},
+    {"glGetBufferPointerv", (void**)&glad_glGetBufferPointerv, 5},
+    {"glGetBufferSubData", (void**)&glad_glGetBufferSubData, 5},
+    {"glGetClipPlane", (void**)&glad_glGetClipPlane, 0},
+    {"glGetCompressedTexImage", (void**)&glad_glGetCompressedTexImage, 3},
+    {"glGetCompressedTextureImage", (void**)&glad_glGetCompressedTextureImage, 17},
+    {"glGetCompressedTextureSubImage", (void**)&glad_glGetCompressedTextureSubImage, 17},
+    {"glGetDebugMessageLog", (void**)&glad_glGetDebugMessageLog, 15},
+    {"glGetDoublei_v", (void**)&glad_glGetDoublei_v, 13},
+    {"glGetDoublev", (void**)&glad_glGetDoublev, 0},
+    {"glGetError", (void**)&glad_glGetError, 0},
+    {"glGetFloati_v", (void**)&glad_glGetFloati_v, 13},
+    {"glGetFloatv", (void**)&glad_glGetFloatv, 0},
+    {"glGetFragDataIndex", (void**)&glad_glGetFragDataIndex, 11},
+    {"glGetFragDataLocation", (void**)&glad_glGetFragDataLocation, 8},
+    {"glGetFramebufferAttachmentParameteriv", (void**)&glad_glGetFramebufferAttachmentParameteriv, 8},
+    {"glGetFramebufferParameteriv", (void**)&glad_glGetFramebufferParameteriv, 15},
+    {"glGetGraphicsResetStatus", (void**)&glad_glGetGraphicsResetStatus, 17},
+    {"glGetInteger64i_v", (void**)&glad_glGetInteger64i_v, 10},
+    {"glGetInteger64v", (void**)&glad_glGetInteger64v, 10},
+    {"glGetIntegeri_v", (void**)&glad_glGetIntegeri_v, 8},
+    {"glGetIntegerv", (void**)&glad_glGetIntegerv, 0},
+    {"glGetInternalformati64v", (void**)&glad_glGetInternalformati64v, 15},
+    {"glGetInternalformativ", (void**)&glad_glGetInternalformativ, 14},
+    {"glGetLightfv", (void**)&glad_glGetLightfv, 0},
+    {"glGetLightiv", (void**)&glad_glGetLightiv, 0},
+    {"glGetMapdv", (void**)&glad_glGetMapdv, 0},
+    {"glGetMapfv", (void**)&glad_glGetMapfv, 0},
+    {"glGetMapiv", (void**)&glad_glGetMapiv, 0},
+    {"glGetMaterialfv", (void**)&glad_glGetMaterialfv, 0},
+    {"glGetMaterialiv", (void**)&glad_glGetMaterialiv, 0},
+    {"glGetMultisamplefv", (void**)&glad_glGetMultisamplefv, 10},
+    {"glGetNamedBufferParameteri64v", (void**)&glad_glGetNamedBufferParameteri64v, 17},
+    {"glGetNamedBufferParameteriv", (void**)&glad_glGetNamedBufferParameteriv, 17},
+    {"glGetNamedBufferPointerv", (void**)&glad_glGetNamedBufferPointerv, 17},
+    {"glGetNamedBufferSubData", (void**)&glad_glGetNamedBufferSubData, 17},
+    {"glGetNamedFramebufferAttachmentParameteriv", (void**)&glad_glGetNamedFramebufferAttachmentParameteriv, 17},
+    {"glGetNamedFramebufferParameteriv", (void**)&glad_glGetNamedFramebufferParameteriv, 17},
+    {"glGetNamedRenderbufferParameteriv", (void**)&glad_glGetNamedRenderbufferParameteriv, 17},
+    {"glGetObjectLabel", (void**)&glad_glGetObjectLabel, 15},
+    {"glGetObjectPtrLabel", (void**)&glad_glGetObjectPtrLabel, 15},
+    {"glGetPixelMapfv", (void**)&glad_glGetPixelMapfv, 0},
+    {"glGetPixelMapuiv", (void**)&glad_glGetPixelMapuiv, 0},
+    {"glGetPixelMapusv", (void**)&glad_glGetPixelMapusv, 0},
+    {"glGetPointerv", (void**)&glad_glGetPointerv, 1},
+    {"glGetPolygonStipple", (void**)&glad_glGetPolygonStipple, 0},
+    {"glGetProgramBinary", (void**)&glad_glGetProgramBinary, 13},
+    {"glGetProgramInfoLog", (void**)&glad_glGetProgramInfoLog, 6},
+    {"glGetProgramInterfaceiv", (void**)&glad_glGetProgramInterfaceiv, 15},
+    {"glGetProgramPipelineInfoLog", (void**)&glad_glGetProgramPipelineInfoLog, 13},
+    {"glGetProgramPipelineiv", (void**)&glad_glGetProgramPipelineiv, 13},
+    {"glGetProgramResourceIndex", (void**)&glad_glGetProgramResourceIndex, 15},
+    {"glGetProgramResourceLocation", (void**)&glad_glGetProgramResourceLocation, 15},
+    {"glGetProgramResourceLocationIndex", (void**)&glad_glGetProgramResourceLocationIndex, 15},
+    {"glGetProgramResourceName", (void**)&glad_glGetProgramResourceName, 15},
+    {"glGetProgramResourceiv", (void**)&glad_glGetProgramResourceiv, 15},
+    {"glGetProgramStageiv", (void**)&glad_glGetProgramStageiv, 12},
+    {"glGetProgramiv", (void**)&glad_glGetProgramiv, 6},
+    {"glGetQueryBufferObjecti64v", (void**)&glad_glGetQueryBufferObjecti64v, 17},
+    {"glGetQueryBufferObjectiv", (void**)&glad_glGetQueryBufferObjectiv, 17},
+    {"glGetQueryBufferObjectui64v", (void**)&glad_glGetQueryBufferObjectui64v, 17},
+    {"glGetQueryBufferObjectuiv", (void**)&glad_glGetQueryBufferObjectuiv, 17},
+    {"glGetQueryIndexediv", (void**)&glad_glGetQueryIndexediv, 12},
+    {"glGetQueryObjecti64v", (void**)&glad_glGetQueryObjecti64v, 11},
+    {"glGetQueryObjectiv", (void**)&glad_glGetQueryObjectiv, 5},
+    {"glGetQueryObjectui64v", (void**)&glad_glGetQueryObjectui64v, 11},
+    {"glGetQueryObjectuiv", (void**)&glad_glGetQueryObjectuiv, 5},
+    {"glGetQueryiv", (void**)&glad_glGetQueryiv, 5},
+    {"glGetRenderbufferParameteriv", (void**)&glad_glGetRenderbufferParameteriv, 8},
+    {"glGetSamplerParameterIiv", (void**)&glad_glGetSamplerParameterIiv, 11},
+    {"glGetSamplerParameterIuiv", (void**)&glad_glGetSamplerParameterIuiv, 11},
+    {"glGetSamplerParameterfv", (void**)&glad_glGetSamplerParameterfv, 11},
+    {"glGetSamplerParameteriv", (void**)&glad_glGetSamplerParameteriv, 11},
+    {"glGetShaderInfoLog", (void**)&glad_glGetShaderInfoLog, 6},
+    {"glGetShaderPrecisionFormat", (void**)&glad_glGetShaderPrecisionFormat, 13},
+    {"glGetShaderSource", (void**)&glad_glGetShaderSource, 6},
+    {"glGetShaderiv", (void**)&glad_glGetShaderiv, 6},
+    {"glGetString", (void**)&glad_glGetString, 0},
+    {"glGetStringi", (void**)&glad_glGetStringi, 8},
+    {"glGetSubroutineIndex", (void**)&glad_glGetSubroutineIndex, 12},
+    {"glGetSubroutineUniformLocation", (void**)&glad_glGetSubroutineUniformLocation, 12},
+    {"glGetSynciv", (void**)&glad_glGetSynciv, 10},
+    {"glGetTexEnvfv", (void**)&glad_glGetTexEnvfv, 0},
+    {"glGetTexEnviv", (void**)&glad_glGetTexEnviv, 0},
+    {"glGetTexGendv", (void**)&glad_glGetTexGendv, 0},
+    {"glGetTexGenfv", (void**)&glad_glGetTexGenfv, 0},
+    {"glGetTexGeniv", (void**)&glad_glGetTexGeniv, 0},
+    {"glGetTexImage", (void**)&glad_glGetTexImage, 0},
+    {"glGetTexLevelParameterfv", (void**)&glad_glGetTexLevelParameterfv, 0},
+    {"glGetTexLevelParameteriv", (void**)&glad_glGetTexLevelParameteriv, 0},
+    {"glGetTexParameterIiv", (void**)&glad_glGetTexParameterIiv, 8},
+    {"glGetTexParameterIuiv", (void**)&glad_glGetTexParameterIuiv, 8},
+    {"glGetTexParameterfv", (void**)&glad_glGetTexParameterfv, 0},
+    {"glGetTexParameteriv", (void**)&glad_glGetTexParameteriv, 0},
+    {"glGetTextureImage", (void**)&glad_glGetTextureImage, 17},
+    {"glGetTextureLevelParameterfv", (void**)&glad_glGetTextureLevelParameterfv, 17},
+    {"glGetTextureLevelParameteriv", (void**)&glad_glGetTextureLevelParameteriv, 17},
+    {"glGetTextureParameterIiv", (void**)&glad_glGetTextureParameterIiv, 17},
+    {"glGetTextureParameterIuiv", (void**)&glad_glGetTextureParameterIuiv, 17},
+    {"glGetTextureParameterfv", (void**)&glad_glGetTextureParameterfv, 17},
+    {"glGetTextureParameteriv", (void**)&glad_glGetTextureParameteriv, 17},
+    {"glGetTextureSubImage", (void**)&glad_glGetTextureSubImage, 17},
+    {"glGetTransformFeedbackVarying", (void**)&glad_glGetTransformFeedbackVarying, 8},
+    {"glGetTransformFeedbacki64_v", (void**)&glad_glGetTransformFeedbacki64_v, 17},
+    {"glGetTransformFeedbacki_v", (void**)&glad_glGetTransformFeedbacki_v, 17},
+    {"glGetTransformFeedbackiv", (void**)&glad_glGetTransformFeedbackiv, 17},
+    {"glGetUniformBlockIndex", (void**)&glad_glGetUniformBlockIndex, 9},
+    {"glGetUniformIndices", (void**)&glad_glGetUniformIndices, 9},
+    {"glGetUniformLocation", (void**)&glad_glGetUniformLocation, 6},
+    {"glGetUniformSubroutineuiv", (void**)&glad_glGetUniformSubroutineuiv, 12},
+    {"glGetUniformdv", (void**)&glad_glGetUniformdv, 12},
+    {"glGetUniformfv", (void**)&glad_glGetUniformfv, 6},
+    {"glGetUniformiv", (void**)&glad_glGetUniformiv, 6},
+    {"glGetUniformuiv", (void**)&glad_glGetUniformuiv, 8},
+    {"glGetVertexArrayIndexed64iv", (void**)&glad_glGetVertexArrayIndexed64iv, 17},
+    {"glGetVertexArrayIndexediv", (void**)&glad_glGetVertexArrayIndexediv, 17},
+    {"glGetVertexArrayiv", (void**)&glad_glGetVertexArrayiv, 17},
+    {"glGetVertexAttribIiv", (void**)&glad_glGetVertexAttribIiv, 8},
+    {"glGetVertexAttribIuiv", (void**)&glad_glGetVertexAttribIuiv, 8},
+    {"glGetVertexAttribLdv", (void**)&glad_glGetVertexAttribLdv, 13},
+    {"glGetVertexAttribPointerv", (void**)&glad_glGetVertexAttribPointerv, 6},
+    {"glGetVertexAttribdv", (void**)&glad_glGetVertexAttribdv, 6},
+    {"glGetVertexAttribfv", (void**)&glad_glGetVertexAttribfv, 6},
+    {"glGetVertexAttribiv", (void**)&glad_glGetVertexAttribiv, 6},
+    {"glGetnColorTable", (void**)&glad_glGetnColorTable, 17},
+    {"glGetnCompressedTexImage", (void**)&glad_glGetnCompressedTexImage, 17},
+    {"glGetnConvolutionFilter", (void**)&glad_glGetnConvolutionFilter, 17},
+    {"glGetnHistogram", (void**)&glad_glGetnHistogram, 17},
+    {"glGetnMapdv", (void**)&glad_glGetnMapdv, 17},
+    {"glGetnMapfv", (void**)&glad_glGetnMapfv, 17},
+    {"glGetnMapiv", (void**)&glad_glGetnMapiv, 17},
+    {"glGetnMinmax", (void**)&glad_glGetnMinmax, 17},
+    {"glGetnPixelMapfv", (void**)&glad_glGetnPixelMapfv, 17},
+    {"glGetnPixelMapuiv", (void**)&glad_glGetnPixelMapuiv, 17},
+    {"glGetnPixelMapusv", (void**)&glad_glGetnPixelMapusv, 17},
+    {"glGetnPolygonStipple", (void**)&glad_glGetnPolygonStipple, 17},
+    {"glGetnSeparableFilter", (void**)&glad_glGetnSeparableFilter, 17},
+    {"glGetnTexImage", (void**)&glad_glGetnTexImage, 17},
+    {"glGetnUniformdv", (void**)&glad_glGetnUniformdv, 17},
+    {"glGetnUniformfv", (void**)&glad_glGetnUniformfv, 17},
+    {"glGetnUniformiv", (void**)&glad_glGetnUniformiv, 17},
+    {"glGetnUniformuiv", (void**)&glad_glGetnUniformuiv, 17},
+    {"glHint", (void**)&glad_glHint, 0},
+    {"glIndexMask", (void**)&glad_glIndexMask, 0},
+    {"glIndexPointer", (void**)&glad_glIndexPointer, 1},
+    {"glIndexd", (void**)&glad_glIndexd, 0},
+    {"glIndexdv", (void**)&glad_glIndexdv, 0},
+    {"glIndexf", (void**)&glad_glIndexf, 0},
+    {"glIndexfv", (void**)&glad_glIndexfv, 0},
+    {"glIndexi", (void**)&glad_glIndexi, 0},
+    {"glIndexiv", (void**)&glad_glIndexiv, 0},
+    {"glIndexs", (void**)&glad_glIndexs, 0},
+    {"glIndexsv", (void**)&glad_glIndexsv, 0},
+    {"glIndexub", (void**)&glad_glIndexub, 1},
+    {"glIndexubv", (void**)&glad_glIndexubv, 1},
+    {"glInitNames", (void**)&glad_glInitNames, 0},
+    {"glInterleavedArrays", (void**)&glad_glInterleavedArrays, 1},
+    {"glInvalidateBufferData", (void**)&glad_glInvalidateBufferData, 15},
+    {"glInvalidateBufferSubData", (void**)&glad_glInvalidateBufferSubData, 15},
+    {"glInvalidateFramebuffer", (void**)&glad_glInvalidateFramebuffer, 15},
+    {"glInvalidateNamedFramebufferData", (void**)&glad_glInvalidateNamedFramebufferData, 17},
+    {"glInvalidateNamedFramebufferSubData", (void**)&glad_glInvalidateNamedFramebufferSubData, 17},
+    {"glInvalidateSubFramebuffer", (void**)&glad_glInvalidateSubFramebuffer, 15},
+    {"glInvalidateTexImage", (void**)&glad_glInvalidateTexImage, 15},
+    {"glInvalidateTexSubImage", (void**)&glad_glInvalidateTexSubImage, 15},
+    {"glIsBuffer", (void**)&glad_glIsBuffer, 5},
+    {"glIsEnabled", (void**)&glad_glIsEnabled, 0},
+    {"glIsEnabledi", (void**)&glad_glIsEnabledi, 8},
+    {"glIsFramebuffer", (void**)&glad_glIsFramebuffer, 8},
+    {"glIsList", (void**)&glad_glIsList, 0},
+    {"glIsProgram", (void**)&glad_glIsProgram, 6},
+    {"glIsProgramPipeline", (void**)&glad_glIsProgramPipeline, 13},
+    {"glIsQuery", (void**)&glad_glIsQuery, 5},
+    {"glIsRenderbuffer", (void**)&glad_glIsRenderbuffer, 8},
+    {"glIsSampler", (void**)&glad_glIsSampler, 11},
+    {"glIsShader", (void**)&glad_glIsShader, 6},
+    {"glIsSync", (void**)&glad_glIsSync, 10},
+    {"glIsTexture", (void**)&glad_glIsTexture, 1},
+    {"glIsTransformFeedback", (void**)&glad_glIsTransformFeedback, 12},
+    {"glIsVertexArray", (void**)&glad_glIsVertexArray, 8},
+    {"glLightModelf", (void**)&glad_glLightModelf, 0},
+    {"glLightModelfv", (void**)&glad_glLightModelfv, 0},
+    {"glLightModeli", (void**)&glad_glLightModeli, 0},
+    {"glLightModeliv", (void**)&glad_glLightModeliv, 0},
+    {"glLightf", (void**)&glad_glLightf, 0},
+    {"glLightfv", (void**)&glad_glLightfv, 0},
+    {"glLighti", (void**)&glad_glLighti, 0},
+    {"glLightiv", (void**)&glad_glLightiv, 0},
+    {"glLineStipple", (void**)&glad_glLineStipple, 0},
+    {"glLineWidth", (void**)&glad_glLineWidth, 0},
+    {"glLinkProgram", (void**)&glad_glLinkProgram, 6},
+    {"glListBase", (void**)&glad_glListBase, 0},
+    {"glLoadIdentity", (void**)&glad_glLoadIdentity, 0},
+    {"glLoadMatrixd", (void**)&glad_glLoadMatrixd, 0},
+    {"glLoadMatrixf", (void**)&glad_glLoadMatrixf, 0},
+    {"glLoadName", (void**)&glad_glLoadName, 0},
+    {"glLoadTransposeMatrixd", (void**)&glad_glLoadTransposeMatrixd, 3},
+    {"glLoadTransposeMatrixf", (void**)&glad_glLoadTransposeMatrixf, 3},
+    {"glLogicOp", (void**)&glad_glLogicOp, 0},
+    {"glMap1d", (void**)&glad_glMap1d, 0},
+    {"glMap1f", (void**)&glad_glMap1f, 0},
+    {"glMap2d", (void**)&glad_glMap2d, 0},
+    {"glMap2f", (void**)&glad_glMap2f, 0},
+    {"glMapBuffer", (void**)&glad_glMapBuffer, 5},
+    {"glMapBufferRange", (void**)&glad_glMapBufferRange, 8},
+    {"glMapGrid1d", (void**)&glad_glMapGrid1d, 0},
+    {"glMapGrid1f", (void**)&glad_glMapGrid1f, 0},
+    {"glMapGrid2d", (void**)&glad_glMapGrid2d, 0},
+    {"glMapGrid2f", (void**)&glad_glMapGrid2f, 0},
+    {"glMapNamedBuffer", (void**)&glad_glMapNamedBuffer, 17},
+    {"glMapNamedBufferRange", (void**)&glad_glMapNamedBufferRange, 17},
+    {"glMaterialf", (void**)&glad_glMaterialf, 0},
+    {"glMaterialfv", (void**)&glad_glMaterialfv, 0},
+    {"glMateriali", (void**)&glad_glMateriali, 0},
+    {"glMaterialiv", (void**)&glad_glMaterialiv, 0},
+    {"glMatrixMode", (void**)&glad_glMatrixMode, 0},
+    {"glMemoryBarrier", (void**)&glad_glMemoryBarrier, 14},
+    {"glMemoryBarrierByRegion", (void**)&glad_glMemoryBarrierByRegion, 17},
+    {"glMinSampleShading", (void**)&glad_glMinSampleShading, 12},
+    {"glMultMatrixd", (void**)&glad_glMultMatrixd, 0},
+    {"glMultMatrixf", (void**)&glad_glMultMatrixf, 0},
+    {"glMultTransposeMatrixd", (void**)&glad_glMultTransposeMatrixd, 3},
+    {"glMultTransposeMatrixf", (void**)&glad_glMultTransposeMatrixf, 3},
+    {"glMultiDrawArrays", (void**)&glad_glMultiDrawArrays, 4},
+    {"glMultiDrawArraysIndirect", (void**)&glad_glMultiDrawArraysIndirect, 15},
+    {"glMultiDrawArraysIndirectCount", (void**)&glad_glMultiDrawArraysIndirectCount, 18},
+    {"glMultiDrawElements", (void**)&glad_glMultiDrawElements, 4},
+    {"glMultiDrawElementsBaseVertex", (void**)&glad_glMultiDrawElementsBaseVertex, 10},
+    {"glMultiDrawElementsIndirect", (void**)&glad_glMultiDrawElementsIndirect, 15},
+    {"glMultiDrawElementsIndirectCount", (void**)&glad_glMultiDrawElementsIndirectCount, 18},
+    {"glMultiTexCoord1d", (void**)&glad_glMultiTexCoord1d, 3},
+    {"glMultiTexCoord1dv", (void**)&glad_glMultiTexCoord1dv, 3},
+    {"glMultiTexCoord1f", (void**)&glad_glMultiTexCoord1f, 3},
+    {"glMultiTexCoord1fv", (void**)&glad_glMultiTexCoord1fv, 3},
+    {"glMultiTexCoord1i", (void**)&glad_glMultiTexCoord1i, 3},
+    {"glMultiTexCoord1iv", (void**)&glad_glMultiTexCoord1iv, 3},
+    {"glMultiTexCoord1s", (void**)&glad_glMultiTexCoord1s, 3},
+    {"glMultiTexCoord1sv", (void**)&glad_glMultiTexCoord1sv, 3},
+    {"glMultiTexCoord2d", (void**)&glad_glMultiTexCoord2d, 3},
+    {"glMultiTexCoord2dv", (void**)&glad_glMultiTexCoord2dv, 3},
+    {"glMultiTexCoord2f", (void**)&glad_glMultiTexCoord2f, 3},
+    {"glMultiTexCoord2fv", (void**)&glad_glMultiTexCoord2fv, 3},
+    {"glMultiTexCoord2i", (void**)&glad_glMultiTexCoord2i, 3},
+    {"glMultiTexCoord2iv", (void**)&glad_glMultiTexCoord2iv, 3},
+    {"glMultiTexCoord2s", (void**)&glad_glMultiTexCoord2s, 3},
+    {"glMultiTexCoord2sv", (void**)&glad_glMultiTexCoord2sv, 3},
+    {"glMultiTexCoord3d", (void**)&glad_glMultiTexCoord3d, 3},
+    {"glMultiTexCoord3dv", (void**)&glad_glMultiTexCoord3dv, 3},
+    {"glMultiTexCoord3f", (void**)&glad_glMultiTexCoord3f, 3},
+    {"glMultiTexCoord3fv", (void**)&glad_glMultiTexCoord3fv, 3},
+    {"glMultiTexCoord3i", (void**)&glad_glMultiTexCoord3i, 3},
+    {"glMultiTexCoord3iv", (void**)&glad_glMultiTexCoord3iv, 3},
+    {"glMultiTexCoord3s", (void**)&glad_glMultiTexCoord3s, 3},
+    {"glMultiTexCoord3sv", (void**)&glad_glMultiTexCoord3sv, 3},
+    {"glMultiTexCoord4d", (void**)&glad_glMultiTexCoord4d, 3},
+    {"glMultiTexCoord4dv", (void**)&glad_glMultiTexCoord4dv, 3},
+    {"glMultiTexCoord4f", (void**)&glad_glMultiTexCoord4f, 3},
+    {"glMultiTexCoord4fv", (void**)&glad_glMultiTexCoord4fv, 3},
+    {"glMultiTexCoord4i", (void**)&glad_glMultiTexCoord4i, 3},
+    {"glMultiTexCoord4iv", (void**)&glad_glMultiTexCoord4iv, 3},
+    {"glMultiTexCoord4s", (void**)&glad_glMultiTexCoord4s, 3},
+    {"glMultiTexCoord4sv", (void**)&glad_glMultiTexCoord4sv, 3},
+    {"glMultiTexCoordP1ui", (void**)&glad_glMultiTexCoordP1ui, 11},
+    {"glMultiTexCoordP1uiv", (void**)&glad_glMultiTexCoordP1uiv, 11},
+    {"glMultiTexCoordP2ui", (void**)&glad_glMultiTexCoordP2ui, 11},
+    {"glMultiTexCoordP2uiv", (void**)&glad_glMultiTexCoordP2uiv, 11},
+    {"glMultiTexCoordP3ui", (void**)&glad_glMultiTexCoordP3ui, 11},
+    {"glMultiTexCoordP3uiv", (void**)&glad_glMultiTexCoordP3uiv, 11},
+    {"glMultiTexCoordP4ui", (void**)&glad_glMultiTexCoordP4ui, 11},
+    {"glMultiTexCoordP4uiv", (void**)&glad_glMultiTexCoordP4uiv, 11},
+    {"glNamedBufferData", (void**)&glad_glNamedBufferData, 17},
+    {"glNamedBufferStorage", (void**)&glad_glNamedBufferStorage, 17},
+    {"glNamedBufferSubData", (void**)&glad_glNamedBufferSubData, 17},
+    {"glNamedFramebufferDrawBuffer", (void**)&glad_glNamedFramebufferDrawBuffer, 17},
+    {"glNamedFramebufferDrawBuffers", (void**)&glad_glNamedFramebufferDrawBuffers, 17},
+    {"glNamedFramebufferParameteri", (void**)&glad_glNamedFramebufferParameteri, 17},
+    {"glNamedFramebufferReadBuffer", (void**)&glad_glNamedFramebufferReadBuffer, 17},
+    {"glNamedFramebufferRenderbuffer", (void**)&glad_glNamedFramebufferRenderbuffer, 17},
+    {"glNamedFramebufferTexture", (void**)&glad_glNamedFramebufferTexture, 17},
+    {"glNamedFramebufferTextureLayer", (void**)&glad_glNamedFramebufferTextureLayer, 17},
+    {"glNamedRenderbufferStorage", (void**)&glad_glNamedRenderbufferStorage, 17},
+    {"glNamedRenderbufferStorageMultisample", (void**)&glad_glNamedRenderbufferStorageMultisample, 17},
+    {"glNewList", (void**)&glad_glNewList, 0},
+    {"glNormal3b", (void**)&glad_glNormal3b, 0},
+    {"glNormal3bv", (void**)&glad_glNormal3bv, 0},
+    {"glNormal3d", (void**)&glad_glNormal3d, 0},
+    {"glNormal3dv", (void**)&glad_glNormal3dv, 0},
+    {"glNormal3f", (void**)&glad_glNormal3f, 0},
+    {"glNormal3fv", (void**)&glad_glNormal3fv, 0},
+    {"glNormal3i", (void**)&glad_glNormal3i, 0},
+    {"glNormal3iv", (void**)&glad_glNormal3iv, 0},
+    {"glNormal3s", (void**)&glad_glNormal3s, 0},
+    {"glNormal3sv", (void**)&glad_glNormal3sv, 0},
+    {"glNormalP3ui", (void**)&glad_glNormalP3ui, 11},
+    {"glNormalP3uiv", (void**)&glad_glNormalP3uiv, 11},
+    {"glNormalPointer", (void**)&glad_glNormalPointer, 1},
+    {"glObjectLabel", (void**)&glad_glObjectLabel, 15},
+    {"glObjectPtrLabel", (void**)&glad_glObjectPtrLabel, 15},
+    {"glOrtho", (void**)&glad_glOrtho, 0},
+    {"glPassThrough", (void**)&glad_glPassThrough, 0},
+    {"glPatchParameterfv", (void**)&glad_glPatchParameterfv, 12},
+    {"glPatchParameteri", (void**)&glad_glPatchParameteri, 12},
+    {"glPauseTransformFeedback", (void**)&glad_glPauseTransformFeedback, 12},
+    {"glPixelMapfv", (void**)&glad_glPixelMapfv, 0},
+    {"glPixelMapuiv", (void**)&glad_glPixelMapuiv, 0},
+    {"glPixelMapusv", (void**)&glad_glPixelMapusv, 0},
+    {"glPixelStoref", (void**)&glad_glPixelStoref, 0},
+    {"glPixelStorei", (void**)&glad_glPixelStorei, 0},
+    {"glPixelTransferf", (void**)&glad_glPixelTransferf, 0},
+    {"glPixelTransferi", (void**)&glad_glPixelTransferi, 0},
+    {"glPixelZoom", (void**)&glad_glPixelZoom, 0},
+    {"glPointParameterf", (void**)&glad_glPointParameterf, 4},
+    {"glPointParameterfv", (void**)&glad_glPointParameterfv, 4},
+    {"glPointParameteri", (void**)&glad_glPointParameteri, 4},
+    {"glPointParameteriv", (void**)&glad_glPointParameteriv, 4},
+    {"glPointSize", (void**)&glad_glPointSize, 0},
+    {"glPolygonMode", (void**)&glad_glPolygonMode, 0},
+    {"glPolygonOffset", (void**)&glad_glPolygonOffset, 1},
+    {"glPolygonOffsetClamp", (void**)&glad_glPolygonOffsetClamp, 18},
+    {"glPolygonStipple", (void**)&glad_glPolygonStipple, 0},
+    {"glPopAttrib", (void**)&glad_glPopAttrib, 0},
+    {"glPopClientAttrib", (void**)&glad_glPopClientAttrib, 1},
+    {"glPopDebugGroup", (void**)&glad_glPopDebugGroup, 15},
+    {"glPopMatrix", (void**)&glad_glPopMatrix, 0},
+    {"glPopName", (void**)&glad_glPopName, 0},
+    {"glPrimitiveRestartIndex", (void**)&glad_glPrimitiveRestartIndex, 9},
+    {"glPrioritizeTextures", (void**)&glad_glPrioritizeTextures, 1},
+    {"glProgramBinary", (void**)&glad_glProgramBinary, 13},
+    {"glProgramParameteri", (void**)&glad_glProgramParameteri, 13},
+    {"glProgramUniform1d", (void**)&glad_glProgramUniform1d, 13},
+    {"glProgramUniform1dv", (void**)&glad_glProgramUniform1dv, 13},
+    {"glProgramUniform1f", (void**)&glad_glProgramUniform1f, 13},
+    {"glProgramUniform1fv", (void**)&glad_glProgramUniform1fv, 13},
+    {"glProgramUniform1i", (void**)&glad_glProgramUniform1i, 13},
+    {"glProgramUniform1iv", (void**)&glad_glProgramUniform1iv, 13},
+    {"glProgramUniform1ui", (void**)&glad_glProgramUniform1ui, 13},
+    {"glProgramUniform1uiv", (void**)&glad_glProgramUniform1uiv, 13},
+    {"glProgramUniform2d", (void**)&glad_glProgramUniform2d, 13},
+    {"glProgramUniform2dv", (void**)&glad_glProgramUniform2dv, 13},
+    {"glProgramUniform2f", (void**)&glad_glProgramUniform2f, 13},
+    {"glProgramUniform2fv", (void**)&glad_glProgramUniform2fv, 13},
+    {"glProgramUniform2i", (void**)&glad_glProgramUniform2i, 13},
+    {"glProgramUniform2iv", (void**)&glad_glProgramUniform2iv, 13},
+    {"glProgramUniform2ui", (void**)&glad_glProgramUniform2ui, 13},
+    {"glProgramUniform2uiv", (void**)&glad_glProgramUniform2uiv, 13},
+    {"glProgramUniform3d", (void**)&glad_glProgramUniform3d, 13},
+    {"glProgramUniform3dv", (void**)&glad_glProgramUniform3dv, 13},
+    {"glProgramUniform3f", (void**)&glad_glProgramUniform3f, 13},
+    {"glProgramUniform3fv", (void**)&glad_glProgramUniform3fv, 13},
+    {"glProgramUniform3i", (void**)&glad_glProgramUniform3i, 13},
+    {"glProgramUniform3iv", (void**)&glad_glProgramUniform3iv, 13},
+    {"glProgramUniform3ui", (void**)&glad_glProgramUniform3ui, 13},
+    {"glProgramUniform3uiv", (void**)&glad_glProgramUniform3uiv, 13},
+    {"glProgramUniform4d", (void**)&glad_glProgramUniform4d, 13},
+    {"glProgramUniform4dv", (void**)&glad_glProgramUniform4dv, 13},
+    {"glProgramUniform4f", (void**)&glad_glProgramUniform4f, 13},
+    {"glProgramUniform4fv", (void**)&glad_glProgramUniform4fv, 13},
+    {"glProgramUniform4i", (void**)&glad_glProgramUniform4i, 13},
+    {"glProgramUniform4iv", (void**)&glad_glProgramUniform4iv, 13},
+    {"glProgramUniform4ui", (void**)&glad_glProgramUniform4ui, 13},
+    {"glProgramUniform4uiv", (void**)&glad_glProgramUniform4uiv, 13},
+    {"glProgramUniformMatrix2dv", (void**)&glad_glProgramUniformMatrix2dv, 13},
+    {"glProgramUniformMatrix2fv", (void**)&glad_glProgramUniformMatrix2fv, 13},
+    {"glProgramUniformMatrix2x3dv", (void**)&glad_glProgramUniformMatrix2x3dv, 13},
+    {"glProgramUniformMatrix2x3fv", (void**)&glad_glProgramUniformMatrix2x3fv, 13},
+    {"glProgramUniformMatrix2x4dv", (void**)&glad_glProgramUniformMatrix2x4dv, 13},
+    {"glProgramUniformMatrix2x4fv", (void**)&glad_glProgramUniformMatrix2x4fv, 13},
+    {"glProgramUniformMatrix3dv", (void**)&glad_glProgramUniformMatrix3dv, 13},
+    {"glProgramUniformMatrix3fv", (void**)&glad_glProgramUniformMatrix3fv, 13},
+    {"glProgramUniformMatrix3x2dv", (void**)&glad_glProgramUniformMatrix3x2dv, 13},
+    {"glProgramUniformMatrix3x2fv", (void**)&glad_glProgramUniformMatrix3x2fv, 13},
+    {"glProgramUniformMatrix3x4dv", (void**)&glad_glProgramUniformMatrix3x4dv, 13},
+    {"glProgramUniformMatrix3x4fv", (void**)&glad_glProgramUniformMatrix3x4fv, 13},
+    {"glProgramUniformMatrix4dv", (void**)&glad_glProgramUniformMatrix4dv, 13},
+    {"glProgramUniformMatrix4fv", (void**)&glad_glProgramUniformMatrix4fv, 13},
+    {"glProgramUniformMatrix4x2dv", (void**)&glad_glProgramUniformMatrix4x2dv, 13},
+    {"glProgramUniformMatrix4x2fv", (void**)&glad_glProgramUniformMatrix4x2fv, 13},
+    {"glProgramUniformMatrix4x3dv", (void**)&glad_glProgramUniformMatrix4x3dv, 13},
+    {"glProgramUniformMatrix4x3fv", (void**)&glad_glProgramUniformMatrix4x3fv, 13},
+    {"glProvokingVertex", (void**)&glad_glProvokingVertex, 10},
+    {"glPushAttrib", (void**)&glad_glPushAttrib, 0},
+    {"glPushClientAttrib", (void**)&glad_glPushClientAttrib, 1},
+    {"glPushDebugGroup", (void**)&glad_glPushDebugGroup, 15},
+    {"glPushMatrix", (void**)&glad_glPushMatrix, 0},
+    {"glPushName", (void**)&glad_glPushName, 0},
+    {"glQueryCounter", (void**)&glad_glQueryCounter, 11},
+    {"glRasterPos2d", (void**)&glad_glRasterPos2d, 0},
+    {"glRasterPos2dv", (void**)&glad_glRasterPos2dv, 0},
+    {"glRasterPos2f", (void**)&glad_glRasterPos2f, 0},
+    {"glRasterPos2fv", (void**)&glad_glRasterPos2fv, 0},
+    {"glRasterPos2i", (void**)&glad_glRasterPos2i, 0},
+    {"glRasterPos2iv", (void**)&glad_glRasterPos2iv, 0},
+    {"glRasterPos2s", (void**)&glad_glRasterPos2s, 0},
+    {"glRasterPos2sv", (void**)&glad_glRasterPos2sv, 0},
+    {"glRasterPos3d", (void**)&glad_glRasterPos3d, 0},
+    {"glRasterPos3dv", (void**)&glad_glRasterPos3dv, 0},
+    {"glRasterPos3f", (void**)&glad_glRasterPos3f, 0},
+    {"glRasterPos3fv", (void**)&glad_glRasterPos3fv, 0},
+    {"glRasterPos3i", (void**)&glad_glRasterPos3i, 0},
+    {"glRasterPos3iv", (void**)&glad_glRasterPos3iv, 0},
+    {"glRasterPos3s", (void**)&glad_glRasterPos3s, 0},
+    {"glRasterPos3sv", (void**)&glad_glRasterPos3sv, 0},
+    {"glRasterPos4d", (void**)&glad_glRasterPos4d, 0},
+    {"glRasterPos4dv", (void**)&glad_glRasterPos4dv, 0},
+    {"glRasterPos4f", (void**)&glad_glRasterPos4f, 0},
+    {"glRasterPos4fv", (void**)&glad_glRasterPos4fv, 0},
+    {"glRasterPos4i", (void**)&glad_glRasterPos4i, 0},
+    {"glRasterPos4iv", (void**)&glad_glRasterPos4iv, 0},
+    {"glRasterPos4s", (void**)&glad_glRasterPos4s, 0},
+    {"glRasterPos4sv", (void**)&glad_glRasterPos4sv, 0},
+    {"glReadBuffer", (void**)&glad_glReadBuffer, 0},
+    {"glReadPixels", (void**)&glad_glReadPixels, 0},
+    {"glReadnPixels", (void**)&glad_glReadnPixels, 17},
+    {"glRectd", (void**)&glad_glRectd, 0},
+    {"glRectdv", (void**)&glad_glRectdv, 0},
+    {"glRectf", (void**)&glad_glRectf, 0},
+    {"glRectfv", (void**)&glad_glRectfv, 0},
+    {"glRecti", (void**)&glad_glRecti, 0},
+    {"glRectiv", (void**)&glad_glRectiv, 0},
+    {"glRects", (void**)&glad_glRects, 0},
+    {"glRectsv", (void**)&glad_glRectsv, 0},
+    {"glReleaseShaderCompiler", (void**)&glad_glReleaseShaderCompiler, 13},
+    {"glRenderMode", (void**)&glad_glRenderMode, 0},
+    {"glRenderbufferStorage", (void**)&glad_glRenderbufferStorage, 8},
+    {"glRenderbufferStorageMultisample", (void**)&glad_glRenderbufferStorageMultisample, 8},
+    {"glResumeTransformFeedback", (void**)&glad_glResumeTransformFeedback, 12},
+    {"glRotated", (void**)&glad_glRotated, 0},
+    {"glRotatef", (void**)&glad_glRotatef, 0},
+    {"glSampleCoverage", (void**)&glad_glSampleCoverage, 3},
+    {"glSampleMaski", (void**)&glad_glSampleMaski, 10},
+    {"glSamplerParameterIiv", (void**)&glad_glSamplerParameterIiv, 11},
+    {"glSamplerParameterIuiv", (void**)&glad_glSamplerParameterIuiv, 11},
+    {"glSamplerParameterf", (void**)&glad_glSamplerParameterf, 11},
+    {"glSamplerParameterfv", (void**)&glad_glSamplerParameterfv, 11},
+    {"glSamplerParameteri", (void**)&glad_glSamplerParameteri, 11},
+    {"glSamplerParameteriv", (void**)&glad_glSamplerParameteriv, 11},
+    {"glScaled", (void**)&glad_glScaled, 0},
+    {"glScalef", (void**)&glad_glScalef, 0},
+    {"glScissor", (void**)&glad_glScissor, 0},
+    {"glScissorArrayv", (void**)&glad_glScissorArrayv, 13},
+    {"glScissorIndexed", (void**)&glad_glScissorIndexed, 13},
+    {"glScissorIndexedv", (void**)&glad_glScissorIndexedv, 13},
+    {"glSecondaryColor3b", (void**)&glad_glSecondaryColor3b, 4},
+    {"glSecondaryColor3bv", (void**)&glad_glSecondaryColor3bv, 4},
+    {"glSecondaryColor3d", (void**)&glad_glSecondaryColor3d, 4},
+    {"glSecondaryColor3dv", (void**)&glad_glSecondaryColor3dv, 4},
+    {"glSecondaryColor3f", (void**)&glad_glSecondaryColor3f, 4},
+    {"glSecondaryColor3fv", (void**)&glad_glSecondaryColor3fv, 4},
+    {"glSecondaryColor3i", (void**)&glad_glSecondaryColor3i, 4},
+    {"glSecondaryColor3iv", (void**)&glad_glSecondaryColor3iv, 4},
+    {"glSecondaryColor3s", (void**)&glad_glSecondaryColor3s, 4},
+    {"glSecondaryColor3sv", (void**)&glad_glSecondaryColor3sv, 4},
+    {"glSecondaryColor3ub", (void**)&glad_glSecondaryColor3ub, 4},
+    {"glSecondaryColor3ubv", (void**)&glad_glSecondaryColor3ubv, 4},
+    {"glSecondaryColor3ui", (void**)&glad_glSecondaryColor3ui, 4},
+    {"glSecondaryColor3uiv", (void**)&glad_glSecondaryColor3uiv, 4},
+    {"glSecondaryColor3us", (void**)&glad_glSecondaryColor3us, 4},
+    {"glSecondaryColor3usv", (void**)&glad_glSecondaryColor3usv, 4},
+    {"glSecondaryColorP3ui", (void**)&glad_glSecondaryColorP3ui, 11},
+    {"glSecondaryColorP3uiv", (void**)&glad_glSecondaryColorP3uiv, 11},
+    {"glSecondaryColorPointer", (void**)&glad_glSecondaryColorPointer, 4},
+    {"glSelectBuffer", (void**)&glad_glSelectBuffer, 0},
+    {"glShadeModel", (void**)&glad_glShadeModel, 0},
+    {"glShaderBinary", (void**)&glad_glShaderBinary, 13},
+    {"glShaderSource", (void**)&glad_glShaderSource, 6},
+    {"glShaderStorageBlockBinding", (void**)&glad_glShaderStorageBlockBinding, 15},
+    {"glSpecializeShader", (void**)&glad_glSpecializeShader, 18},
+    {"glStencilFunc", (void**)&glad_glStencilFunc, 0},
+    {"glStencilFuncSeparate", (void**)&glad_glStencilFuncSeparate, 6},
+    {"glStencilMask", (void**)&glad_glStencilMask, 0},
+    {"glStencilMaskSeparate", (void**)&glad_glStencilMaskSeparate, 6},
+    {"glStencilOp", (void**)&glad_glStencilOp, 0},
+    {"glStencilOpSeparate", (void**)&glad_glStencilOpSeparate, 6},
+    {"glTexBuffer", (void**)&glad_glTexBuffer, 9},
+    {"glTexBufferRange", (void**)&glad_glTexBufferRange, 15},
+    {"glTexCoord1d", (void**)&glad_glTexCoord1d, 0},
+    {"glTexCoord1dv", (void**)&glad_glTexCoord1dv, 0},
+    {"glTexCoord1f", (void**)&glad_glTexCoord1f, 0},
+    {"glTexCoord1fv", (void**)&glad_glTexCoord1fv, 0},
+    {"glTexCoord1i", (void**)&glad_glTexCoord1i, 0},
+    {"glTexCoord1iv", (void**)&glad_glTexCoord1iv, 0},
+    {"glTexCoord1s", (void**)&glad_glTexCoord1s, 0},
+    {"glTexCoord1sv", (void**)&glad_glTexCoord1sv, 0},
+    {"glTexCoord2d", (void**)&glad_glTexCoord2d, 0},
+    {"glTexCoord2dv", (void**)&glad_glTexCoord2dv, 0},
+    {"glTexCoord2f", (void**)&glad_glTexCoord2f, 0},
+    {"glTexCoord2fv", (void**)&glad_glTexCoord2fv, 0},
+    {"glTexCoord2i", (void**)&glad_glTexCoord2i, 0},
+    {"glTexCoord2iv", (void**)&glad_glTexCoord2iv, 0},
+    {"glTexCoord2s", (void**)&glad_glTexCoord2s, 0},
+    {"glTexCoord2sv", (void**)&glad_glTexCoord2sv, 0},
+    {"glTexCoord3d", (void**)&glad_glTexCoord3d, 0},
+    {"glTexCoord3dv", (void**)&glad_glTexCoord3dv, 0},
+    {"glTexCoord3f", (void**)&glad_glTexCoord3f, 0},
+    {"glTexCoord3fv", (void**)&glad_glTexCoord3fv, 0},
+    {"glTexCoord3i", (void**)&glad_glTexCoord3i, 0},
+    {"glTexCoord3iv", (void**)&glad_glTexCoord3iv, 0},
+    {"glTexCoord3s", (void**)&glad_glTexCoord3s, 0},
+    {"glTexCoord3sv", (void**)&glad_glTexCoord3sv, 0},
+    {"glTexCoord4d", (void**)&glad_glTexCoord4d, 0},
+    {"glTexCoord4dv", (void**)&glad_glTexCoord4dv, 0},
+    {"glTexCoord4f", (void**)&glad_glTexCoord4f, 0},
+    {"glTexCoord4fv", (void**)&glad_glTexCoord4fv, 0},
+    {"glTexCoord4i", (void**)&glad_glTexCoord4i, 0},
+    {"glTexCoord4iv", (void**)&glad_glTexCoord4iv, 0},
+    {"glTexCoord4s", (void**)&glad_glTexCoord4s, 0},
+    {"glTexCoord4sv", (void**)&glad_glTexCoord4sv, 0},
+    {"glTexCoordP1ui", (void**)&glad_glTexCoordP1ui, 11},
+    {"glTexCoordP1uiv", (void**)&glad_glTexCoordP1uiv, 11},
+    {"glTexCoordP2ui", (void**)&glad_glTexCoordP2ui, 11},
+    {"glTexCoordP2uiv", (void**)&glad_glTexCoordP2uiv, 11},
+    {"glTexCoordP3ui", (void**)&glad_glTexCoordP3ui, 11},
+    {"glTexCoordP3uiv", (void**)&glad_glTexCoordP3uiv, 11},
+    {"glTexCoordP4ui", (void**)&glad_glTexCoordP4ui, 11},
+    {"glTexCoordP4uiv", (void**)&glad_glTexCoordP4uiv, 11},
+    {"glTexCoordPointer", (void**)&glad_glTexCoordPointer, 1},
+    {"glTexEnvf", (void**)&glad_glTexEnvf, 0},
+    {"glTexEnvfv", (void**)&glad_glTexEnvfv, 0},
+    {"glTexEnvi", (void**)&glad_glTexEnvi, 0},
+    {"glTexEnviv", (void**)&glad_glTexEnviv, 0},
+    {"glTexGend", (void**)&glad_glTexGend, 0},
+    {"glTexGendv", (void**)&glad_glTexGendv, 0},
+    {"glTexGenf", (void**)&glad_glTexGenf, 0},
+    {"glTexGenfv", (void**)&glad_glTexGenfv, 0},
+    {"glTexGeni", (void**)&glad_glTexGeni, 0},
+    {"glTexGeniv", (void**)&glad_glTexGeniv, 0},
+    {"glTexImage1D", (void**)&glad_glTexImage1D, 0},
+    {"glTexImage2D", (void**)&glad_glTexImage2D, 0},
+    {"glTexImage2DMultisample", (void**)&glad_glTexImage2DMultisample, 10},
+    {"glTexImage3D", (void**)&glad_glTexImage3D, 2},
+    {"glTexImage3DMultisample", (void**)&glad_glTexImage3DMultisample, 10},
+    {"glTexParameterIiv", (void**)&glad_glTexParameterIiv, 8},
+    {"glTexParameterIuiv", (void**)&glad_glTexParameterIuiv, 8},
+    {"glTexParameterf", (void**)&glad_glTexParameterf, 0},
+    {"glTexParameterfv", (void**)&glad_glTexParameterfv, 0},
+    {"glTexParameteri", (void**)&glad_glTexParameteri, 0},
+    {"glTexParameteriv", (void**)&glad_glTexParameteriv, 0},
+    {"glTexStorage1D", (void**)&glad_glTexStorage1D, 14},
+    {"glTexStorage2D", (void**)&glad_glTexStorage2D, 14},
+    {"glTexStorage2DMultisample", (void**)&glad_glTexStorage2DMultisample, 15},
+    {"glTexStorage3D", (void**)&glad_glTexStorage3D, 14},
+    {"glTexStorage3DMultisample", (void**)&glad_glTexStorage3DMultisample, 15},
+    {"glTexSubImage1D", (void**)&glad_glTexSubImage1D, 1},
+    {"glTexSubImage2D", (void**)&glad_glTexSubImage2D, 1},
+    {"glTexSubImage3D", (void**)&glad_glTexSubImage3D, 2},
+    {"glTextureBarrier", (void**)&glad_glTextureBarrier, 17},
+    {"glTextureBuffer", (void**)&glad_glTextureBuffer, 17},
+    {"glTextureBufferRange", (void**)&glad_glTextureBufferRange, 17},
+    {"glTextureParameterIiv", (void**)&glad_glTextureParameterIiv, 17},
+    {"glTextureParameterIuiv", (void**)&glad_glTextureParameterIuiv, 17},
+    {"glTextureParameterf", (void**)&glad_glTextureParameterf, 17},
+    {"glTextureParameterfv", (void**)&glad_glTextureParameterfv, 17},
+    {"glTextureParameteri", (void**)&glad_glTextureParameteri, 17},
+    {"glTextureParameteriv", (void**)&glad_glTextureParameteriv, 17},
+    {"glTextureStorage1D", (void**)&glad_glTextureStorage1D, 17},
+    {"glTextureStorage2D", (void**)&glad_glTextureStorage2D, 17},
+    {"glTextureStorage2DMultisample", (void**)&glad_glTextureStorage2DMultisample, 17},
+    {"glTextureStorage3D", (void**)&glad_glTextureStorage3D, 17},
+    {"glTextureStorage3DMultisample", (void**)&glad_glTextureStorage3DMultisample, 17},
+    {"glTextureSubImage1D", (void**)&glad_glTextureSubImage1D, 17},
+    {"glTextureSubImage2D", (void**)&glad_glTextureSubImage2D, 17},
+    {"glTextureSubImage3D", (void**)&glad_glTextureSubImage3D, 17},
+    {"glTextureView", (void**)&glad_glTextureView, 15},
+    {"glTransformFeedbackBufferBase", (void**)&glad_glTransformFeedbackBufferBase, 17},
+    {"glTransformFeedbackBufferRange", (void**)&glad_glTransformFeedbackBufferRange, 17},
+    {"glTransformFeedbackVaryings", (void**)&glad_glTransformFeedbackVaryings, 8},
+    {"glTranslated", (void**)&glad_glTranslated, 0},
+    {"glTranslatef", (void**)&glad_glTranslatef, 0},
+    {"glUniform1d", (void**)&glad_glUniform1d, 12},
+    {"glUniform1dv", (void**)&glad_glUniform1dv, 12},
+    {"glUniform1f", (void**)&glad_glUniform1f, 6},
+    {"glUniform1fv", (void**)&glad_glUniform1fv, 6},
+    {"glUniform1i", (void**)&glad_glUniform1i, 6},
+    {"glUniform1iv", (void**)&glad_glUniform1iv, 6},
+    {"glUniform1ui", (void**)&glad_glUniform1ui, 8},
+    {"glUniform1uiv", (void**)&glad_glUniform1uiv, 8},
+    {"glUniform2d", (void**)&glad_glUniform2d, 12},
+    {"glUniform2dv", (void**)&glad_glUniform2dv, 12},
+    {"glUniform2f", (void**)&glad_glUniform2f, 6},
+    {"glUniform2fv", (void**)&glad_glUniform2fv, 6},
+    {"glUniform2i", (void**)&glad_glUniform2i, 6},
+    {"glUniform2iv", (void**)&glad_glUniform2iv, 6},
+    {"glUniform2ui", (void**)&glad_glUniform2ui, 8},
+    {"glUniform2uiv", (void**)&glad_glUniform2uiv, 8},
+    {"glUniform3d", (void**)&glad_glUniform3d, 12},
+    {"glUniform3dv", (void**)&glad_glUniform3dv, 12},
+    {"glUniform3f", (void**)&glad_glUniform3f, 6},
+    {"glUniform3fv", (void**)&glad_glUniform3fv, 6},
+    {"glUniform3i", (void**)&glad_glUniform3i, 6},
+    {"glUniform3iv", (void**)&glad_glUniform3iv, 6},
+    {"glUniform3ui", (void**)&glad_glUniform3ui, 8},
+    {"glUniform3uiv", (void**)&glad_glUniform3uiv, 8},
+    {"glUniform4d", (void**)&glad_glUniform4d, 12},
+    {"glUniform4dv", (void**)&glad_glUniform4dv, 12},
+    {"glUniform4f", (void**)&glad_glUniform4f, 6},
+    {"glUniform4fv", (void**)&glad_glUniform4fv, 6},
+    {"glUniform4i", (void**)&glad_glUniform4i, 6},
+    {"glUniform4iv", (void**)&glad_glUniform4iv, 6},
+    {"glUniform4ui", (void**)&glad_glUniform4ui, 8},
+    {"glUniform4uiv", (void**)&glad_glUniform4uiv, 8},
+    {"glUniformBlockBinding", (void**)&glad_glUniformBlockBinding, 9},
+    {"glUniformMatrix2dv", (void**)&glad_glUniformMatrix2dv, 12},
+    {"glUniformMatrix2fv", (void**)&glad_glUniformMatrix2fv, 6},
+    {"glUniformMatrix2x3dv", (void**)&glad_glUniformMatrix2x3dv, 12},
+    {"glUniformMatrix2x3fv", (void**)&glad_glUniformMatrix2x3fv, 7},
+    {"glUniformMatrix2x4dv", (void**)&glad_glUniformMatrix2x4dv, 12},
+    {"glUniformMatrix2x4fv", (void**)&glad_glUniformMatrix2x4fv, 7},
+    {"glUniformMatrix3dv", (void**)&glad_glUniformMatrix3dv, 12},
+    {"glUniformMatrix3fv", (void**)&glad_glUniformMatrix3fv, 6},
+    {"glUniformMatrix3x2dv", (void**)&glad_glUniformMatrix3x2dv, 12},
+    {"glUniformMatrix3x2fv", (void**)&glad_glUniformMatrix3x2fv, 7},
+    {"glUniformMatrix3x4dv", (void**)&glad_glUniformMatrix3x4dv, 12},
+    {"glUniformMatrix3x4fv", (void**)&glad_glUniformMatrix3x4fv, 7},
+    {"glUniformMatrix4dv", (void**)&glad_glUniformMatrix4dv, 12},
+    {"glUniformMatrix4fv", (void**)&glad_glUniformMatrix4fv, 6},
+    {"glUniformMatrix4x2dv", (void**)&glad_glUniformMatrix4x2dv, 12},
+    {"glUniformMatrix4x2fv", (void**)&glad_glUniformMatrix4x2fv, 7},
+    {"glUniformMatrix4x3dv", (void**)&glad_glUniformMatrix4x3dv, 12},
+    {"glUniformMatrix4x3fv", (void**)&glad_glUniformMatrix4x3fv, 7},
+    {"glUniformSubroutinesuiv", (void**)&glad_glUniformSubroutinesuiv, 12},
+    {"glUnmapBuffer", (void**)&glad_glUnmapBuffer, 5},
+    {"glUnmapNamedBuffer", (void**)&glad_glUnmapNamedBuffer, 17},
+    {"glUseProgram", (void**)&glad_glUseProgram, 6},
+    {"glUseProgramStages", (void**)&glad_glUseProgramStages, 13},
+    {"glValidateProgram", (void**)&glad_glValidateProgram, 6},
+    {"glValidateProgramPipeline", (void**)&glad_glValidateProgramPipeline, 13},
+    {"glVertex2d", (void**)&glad_glVertex2d, 0},
+    {"glVertex2dv", (void**)&glad_glVertex2dv, 0},
+    {"glVertex2f", (void**)&glad_glVertex2f, 0},
+    {"glVertex2fv", (void**)&glad_glVertex2fv, 0},
+    {"glVertex2i", (void**)&glad_glVertex2i, 0},
+    {"glVertex2iv", (void**)&glad_glVertex2iv, 0},
+    {"glVertex2s", (void**)&glad_glVertex2s, 0},
+    {"glVertex2sv", (void**)&glad_glVertex2sv, 0},
+    {"glVertex3d", (void**)&glad_glVertex3d, 0},
+    {"glVertex3dv", (void**)&glad_glVertex3dv, 0},
+    {"glVertex3f", (void**)&glad_glVertex3f, 0},
+    {"glVertex3fv", (void**)&glad_glVertex3fv, 0},
+    {"glVertex3i", (void**)&glad_glVertex3i, 0},
+    {"glVertex3iv", (void**)&glad_glVertex3iv, 0},
+    {"glVertex3s", (void**)&glad_glVertex3s, 0},
+    {"glVertex3sv", (void**)&glad_glVertex3sv, 0},
+    {"glVertex4d", (void**)&glad_glVertex4d, 0},
+    {"glVertex4dv", (void**)&glad_glVertex4dv, 0},
+    {"glVertex4f", (void**)&glad_glVertex4f, 0},
+    {"glVertex4fv", (void**)&glad_glVertex4fv, 0},
+    {"glVertex4i", (void**)&glad_glVertex4i, 0},
+    {"glVertex4iv", (void**)&glad_glVertex4iv, 0},
+    {"glVertex4s", (void**)&glad_glVertex4s, 0},
+    {"glVertex4sv", (void**)&glad_glVertex4sv, 0},
+    {"glVertexArrayAttribBinding", (void**)&glad_glVertexArrayAttribBinding, 17},
+    {"glVertexArrayAttribFormat", (void**)&glad_glVertexArrayAttribFormat, 17},
+    {"glVertexArrayAttribIFormat", (void**)&glad_glVertexArrayAttribIFormat, 17},
+    {"glVertexArrayAttribLFormat", (void**)&glad_glVertexArrayAttribLFormat, 17},
+    {"glVertexArrayBindingDivisor", (void**)&glad_glVertexArrayBindingDivisor, 17},
+    {"glVertexArrayElementBuffer", (void**)&glad_glVertexArrayElementBuffer, 17},
+    {"glVertexArrayVertexBuffer", (void**)&glad_glVertexArrayVertexBuffer, 17},
+    {"glVertexArrayVertexBuffers", (void**)&glad_glVertexArrayVertexBuffers, 17},
+    {"glVertexAttrib1d", (void**)&glad_glVertexAttrib1d, 6},
+    {"glVertexAttrib1dv", (void**)&glad_glVertexAttrib1dv, 6},
+    {"glVertexAttrib1f", (void**)&glad_glVertexAttrib1f, 6},
+    {"glVertexAttrib1fv", (void**)&glad_glVertexAttrib1fv, 6},
+    {"glVertexAttrib1s", (void**)&glad_glVertexAttrib1s, 6},
+    {"glVertexAttrib1sv", (void**)&glad_glVertexAttrib1sv, 6},
+    {"glVertexAttrib2d", (void**)&glad_glVertexAttrib2d, 6},
+    {"glVertexAttrib2dv", (void**)&glad_glVertexAttrib2dv, 6},
+    {"glVertexAttrib2f", (void**)&glad_glVertexAttrib2f, 6},
+    {"glVertexAttrib2fv", (void**)&glad_glVertexAttrib2fv, 6},
+    {"glVertexAttrib2s", (void**)&glad_glVertexAttrib2s, 6},
+    {"glVertexAttrib2sv", (void**)&glad_glVertexAttrib2sv, 6},
+    {"glVertexAttrib3d", (void**)&glad_glVertexAttrib3d, 6},
+    {"glVertexAttrib3dv", (void**)&glad_glVertexAttrib3dv, 6},
+    {"glVertexAttrib3f", (void**)&glad_glVertexAttrib3f, 6},
+    {"glVertexAttrib3fv", (void**)&glad_glVertexAttrib3fv, 6},
+    {"glVertexAttrib3s", (void**)&glad_glVertexAttrib3s, 6},
+    {"glVertexAttrib3sv", (void**)&glad_glVertexAttrib3sv, 6},
+    {"glVertexAttrib4Nbv", (void**)&glad_glVertexAttrib4Nbv, 6},
+    {"glVertexAttrib4Niv", (void**)&glad_glVertexAttrib4Niv, 6},
+    {"glVertexAttrib4Nsv", (void**)&glad_glVertexAttrib4Nsv, 6},
+    {"glVertexAttrib4Nub", (void**)&glad_glVertexAttrib4Nub, 6},
+    {"glVertexAttrib4Nubv", (void**)&glad_glVertexAttrib4Nubv, 6},
+    {"glVertexAttrib4Nuiv", (void**)&glad_glVertexAttrib4Nuiv, 6},
+    {"glVertexAttrib4Nusv", (void**)&glad_glVertexAttrib4Nusv, 6},
+    {"glVertexAttrib4bv", (void**)&glad_glVertexAttrib4bv, 6},
+    {"glVertexAttrib4d", (void**)&glad_glVertexAttrib4d, 6},
+    {"glVertexAttrib4dv", (void**)&glad_glVertexAttrib4dv, 6},
+    {"glVertexAttrib4f", (void**)&glad_glVertexAttrib4f, 6},
+    {"glVertexAttrib4fv", (void**)&glad_glVertexAttrib4fv, 6},
+    {"glVertexAttrib4iv", (void**)&glad_glVertexAttrib4iv, 6},
+    {"glVertexAttrib4s", (void**)&glad_glVertexAttrib4s, 6},
+    {"glVertexAttrib4sv", (void**)&glad_glVertexAttrib4sv, 6},
+    {"glVertexAttrib4ubv", (void**)&glad_glVertexAttrib4ubv, 6},
+    {"glVertexAttrib4uiv", (void**)&glad_glVertexAttrib4uiv, 6},
+    {"glVertexAttrib4usv", (void**)&glad_glVertexAttrib4usv, 6},
+    {"glVertexAttribBinding", (void**)&glad_glVertexAttribBinding, 15},
+    {"glVertexAttribDivisor", (void**)&glad_glVertexAttribDivisor, 11},
+    {"glVertexAttribFormat", (void**)&glad_glVertexAttribFormat, 15},
+    {"glVertexAttribI1i", (void**)&glad_glVertexAttribI1i, 8},
+    {"glVertexAttribI1iv", (void**)&glad_glVertexAttribI1iv, 8},
+    {"glVertexAttribI1ui", (void**)&glad_glVertexAttribI1ui, 8},
+    {"glVertexAttribI1uiv", (void**)&glad_glVertexAttribI1uiv, 8},
+    {"glVertexAttribI2i", (void**)&glad_glVertexAttribI2i, 8},
+    {"glVertexAttribI2iv", (void**)&glad_glVertexAttribI2iv, 8},
+    {"glVertexAttribI2ui", (void**)&glad_glVertexAttribI2ui, 8},
+    {"glVertexAttribI2uiv", (void**)&glad_glVertexAttribI2uiv, 8},
+    {"glVertexAttribI3i", (void**)&glad_glVertexAttribI3i, 8},
+    {"glVertexAttribI3iv", (void**)&glad_glVertexAttribI3iv, 8},
+    {"glVertexAttribI3ui", (void**)&glad_glVertexAttribI3ui, 8},
+    {"glVertexAttribI3uiv", (void**)&glad_glVertexAttribI3uiv, 8},
+    {"glVertexAttribI4bv", (void**)&glad_glVertexAttribI4bv, 8},
+    {"glVertexAttribI4i", (void**)&glad_glVertexAttribI4i, 8},
+    {"glVertexAttribI4iv", (void**)&glad_glVertexAttribI4iv, 8},
+    {"glVertexAttribI4sv", (void**)&glad_glVertexAttribI4sv, 8},
+    {"glVertexAttribI4ubv", (void**)&glad_glVertexAttribI4ubv, 8},
+    {"glVertexAttribI4ui", (void**)&glad_glVertexAttribI4ui, 8},
+    {"glVertexAttribI4uiv", (void**)&glad_glVertexAttribI4uiv, 8},
+    {"glVertexAttribI4usv", (void**)&glad_glVertexAttribI4usv, 8},
+    {"glVertexAttribIFormat", (void**)&glad_glVertexAttribIFormat, 15},
+    {"glVertexAttribIPointer", (void**)&glad_glVertexAttribIPointer, 8},
+    {"glVertexAttribL1d", (void**)&glad_glVertexAttribL1d, 13},
+    {"glVertexAttribL1dv", (void**)&glad_glVertexAttribL1dv, 13},
+    {"glVertexAttribL2d", (void**)&glad_glVertexAttribL2d, 13},
+    {"glVertexAttribL2dv", (void**)&glad_glVertexAttribL2dv, 13},
+    {"glVertexAttribL3d", (void**)&glad_glVertexAttribL3d, 13},
+    {"glVertexAttribL3dv", (void**)&glad_glVertexAttribL3dv, 13},
+    {"glVertexAttribL4d", (void**)&glad_glVertexAttribL4d, 13},
+    {"glVertexAttribL4dv", (void**)&glad_glVertexAttribL4dv, 13},
+    {"glVertexAttribLFormat", (void**)&glad_glVertexAttribLFormat, 15},
+    {"glVertexAttribLPointer", (void**)&glad_glVertexAttribLPointer, 13},
+    {"glVertexAttribP1ui", (void**)&glad_glVertexAttribP1ui, 11},
+    {"glVertexAttribP1uiv", (void**)&glad_glVertexAttribP1uiv, 11},
+    {"glVertexAttribP2ui", (void**)&glad_glVertexAttribP2ui, 11},
+    {"glVertexAttribP2uiv", (void**)&glad_glVertexAttribP2uiv, 11},
+    {"glVertexAttribP3ui", (void**)&glad_glVertexAttribP3ui, 11},
+    {"glVertexAttribP3uiv", (void**)&glad_glVertexAttribP3uiv, 11},
+    {"glVertexAttribP4ui", (void**)&glad_glVertexAttribP4ui, 11},
+    {"glVertexAttribP4uiv", (void**)&glad_glVertexAttribP4uiv, 11},
+    {"glVertexAttribPointer", (void**)&glad_glVertexAttribPointer, 6},
+    {"glVertexBindingDivisor", (void**)&glad_glVertexBindingDivisor, 15},
+    {"glVertexP2ui", (void**)&glad_glVertexP2ui, 11},
+    {"glVertexP2uiv", (void**)&glad_glVertexP2uiv, 11},
+    {"glVertexP3ui", (void**)&glad_glVertexP3ui, 11},
+    {"glVertexP3uiv", (void**)&glad_glVertexP3uiv, 11},
+    {"glVertexP4ui", (void**)&glad_glVertexP4ui, 11},
+    {"glVertexP4uiv", (void**)&glad_glVertexP4uiv, 11},
+    {"glVertexPointer", (void**)&glad_glVertexPointer, 1},
+    {"glViewport", (void**)&glad_glViewport, 0},
+    {"glViewportArrayv", (void**)&glad_glViewportArrayv, 13},
+    {"glViewportIndexedf", (void**)&glad_glViewportIndexedf, 13},
+    {"glViewportIndexedfv", (void**)&glad_glViewportIndexedfv, 13},
+    {"glWaitSync", (void**)&glad_glWaitSync, 10},
+    {"glWindowPos2d", (void**)&glad_glWindowPos2d, 4},
+    {"glWindowPos2dv", (void**)&glad_glWindowPos2dv, 4},
+    {"glWindowPos2f", (void**)&glad_glWindowPos2f, 4},
+    {"glWindowPos2fv", (void**)&glad_glWindowPos2fv, 4},
+    {"glWindowPos2i", (void**)&glad_glWindowPos2i, 4},
+    {"glWindowPos2iv", (void**)&glad_glWindowPos2iv, 4},
+    {"glWindowPos2s", (void**)&glad_glWindowPos2s, 4},
+    {"glWindowPos2sv", (void**)&glad_glWindowPos2sv, 4},
+    {"glWindowPos3d", (void**)&glad_glWindowPos3d, 4},
+    {"glWindowPos3dv", (void**)&glad_glWindowPos3dv, 4},
+    {"glWindowPos3f", (void**)&glad_glWindowPos3f, 4},
+    {"glWindowPos3fv", (void**)&glad_glWindowPos3fv, 4},
+    {"glWindowPos3i", (void**)&glad_glWindowPos3i, 4},
+    {"glWindowPos3iv", (void**)&glad_glWindowPos3iv, 4},
+    {"glWindowPos3s", (void**)&glad_glWindowPos3s, 4},
+    {"glWindowPos3sv", (void**)&glad_glWindowPos3sv, 4}
+};
+
+/* Lazy loading
+ *
+ * gladLoadGLLoaderLazy() only resolves glGetString up front. Every other
+ * pointer of a supported GL version is set to a small trampoline that, on
+ * the first call, asks the loader for the real function, patches the
+ * glad_gl* pointer and jumps to it with the original arguments. Later
+ * calls go straight to the driver. Only the functions the application
+ * actually calls are ever looked up.
+ *
+ * Trampolines have to forward arbitrary signatures, so they are written in
+ * assembly and only exist for x86-64 ELF targets. Everywhere else
+ * gladLoadGLLoaderLazy() falls back to eager loading.
+ *
+ * Note that unlike eager loading, lazy pointers are never NULL for a
+ * supported version, so check GLAD_GL_VERSION_* rather than the pointers.
+ */
+#if defined(__x86_64__) && defined(__ELF__) && defined(__GNUC__)
+#define GLAD_HAS_TRAMPOLINES 1
+#define GLAD_STRINGIFY_(x) #x
+#define GLAD_STRINGIFY(x) GLAD_STRINGIFY_(x)
+#define GLAD_HIDDEN __attribute__((visibility("hidden")))
+#include <pthread.h>
+
+/* 16 byte trampolines, number i loads i into r11 and enters glad_lazy_common */
+GLAD_HIDDEN extern const char glad_lazy_stubs[];
+GLAD_HIDDEN __attribute__((used)) void *glad_lazy_resolve(unsigned int index);
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl glad_lazy_stubs\n"
+    ".hidden glad_lazy_stubs\n"
+    "glad_lazy_stubs:\n"
+    ".set glad_lazy_index, 0\n"
+    ".rept " GLAD_STRINGIFY(GLAD_PROC_COUNT) "\n"
+    "    movl $glad_lazy_index, %r11d\n"
+    "    jmp glad_lazy_common\n"
+    "    .p2align 4\n"
+    "    .set glad_lazy_index, glad_lazy_index + 1\n"
+    ".endr\n"
+    /* Save every argument register (rax carries the vector count for
+     * variadic calls), resolve, restore and tail-jump to the real function */
+    "glad_lazy_common:\n"
+    "    pushq %rbp\n"
+    "    movq %rsp, %rbp\n"
+    "    subq $192, %rsp\n"
+    "    movq %rdi, 0(%rsp)\n"
+    "    movq %rsi, 8(%rsp)\n"
+    "    movq %rdx, 16(%rsp)\n"
+    "    movq %rcx, 24(%rsp)\n"
+    "    movq %r8, 32(%rsp)\n"
+    "    movq %r9, 40(%rsp)\n"
+    "    movq %rax, 48(%rsp)\n"
+    "    movdqa %xmm0, 64(%rsp)\n"
+    "    movdqa %xmm1, 80(%rsp)\n"
+    "    movdqa %xmm2, 96(%rsp)\n"
+    "    movdqa %xmm3, 112(%rsp)\n"
+    "    movdqa %xmm4, 128(%rsp)\n"
+    "    movdqa %xmm5, 144(%rsp)\n"
+    "    movdqa %xmm6, 160(%rsp)\n"
+    "    movdqa %xmm7, 176(%rsp)\n"
+    "    movl %r11d, %edi\n"
+    "    call glad_lazy_resolve\n"
+    "    movq %rax, %r11\n"
+    "    movq 0(%rsp), %rdi\n"
+    "    movq 8(%rsp), %rsi\n"
+    "    movq 16(%rsp), %rdx\n"
+    "    movq 24(%rsp), %rcx\n"
+    "    movq 32(%rsp), %r8\n"
+    "    movq 40(%rsp), %r9\n"
+    "    movq 48(%rsp), %rax\n"
+    "    movdqa 64(%rsp), %xmm0\n"
+    "    movdqa 80(%rsp), %xmm1\n"
+    "    movdqa 96(%rsp), %xmm2\n"
+    "    movdqa 112(%rsp), %xmm3\n"
+    "    movdqa 128(%rsp), %xmm4\n"
+    "    movdqa 144(%rsp), %xmm5\n"
+    "    movdqa 160(%rsp), %xmm6\n"
+    "    movdqa 176(%rsp), %xmm7\n"
+    "    leave\n"
+    "    jmp *%r11\n"
+);
+
+static GLADloadproc glad_lazy_loader = NULL;
+static int glad_lazy_resolved = 0;
+
+void *glad_lazy_resolve(unsigned int index) {
+    const glad_proc_entry *entry = &glad_proc_table[index];
+    void *proc = NULL;
+
+    if(glad_lazy_loader != NULL) {
+        proc = glad_lazy_loader(entry->name);
+    }
+    if(proc == NULL) {
+        fprintf(stderr, "glad: could not resolve %s on first call\n", entry->name);
+        abort();
+    }
+
+    /* Racing threads all store the same value, a plain store is enough */
+    *entry->proc = proc;
+    glad_lazy_resolved++;
+    return proc;
+}
+#endif
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+#ifdef GLAD_HAS_TRAMPOLINES
+    unsigned int index;
+
+    GLVersion.major = 0; GLVersion.minor = 0;
+    glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(glGetString == NULL) return 0;
+    if(glGetString(GL_VERSION) == NULL) return 0;
+    find_coreGL();
+
+    glad_lazy_loader = load;
+    glad_last_loader = load;
+    glad_lazy_resolved = 0;
+    for(index = 0; index < GLAD_PROC_COUNT; index++) {
+        const glad_proc_entry *entry = &glad_proc_table[index];
+
+        if(*glad_version_flags[entry->version]) {
+            *entry->proc = (void*)(glad_lazy_stubs + 16 * index);
+        } else {
+            *entry->proc = NULL;
+        }
+    }
+    /* The extension set is built right away, so load its queries directly */
+    glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+    if(GLAD_GL_VERSION_3_0) glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+
+    if (!find_extensionsGL()) return 0;
+    return GLVersion.major != 0 || GLVersion.minor != 0;
+#else
+    return gladLoadGLLoader(load);
+#endif
+}
+
+int gladLazyResolvedCount(void) {
+#ifdef GLAD_HAS_TRAMPOLINES
+    return glad_lazy_resolved;
+#else
+    return 0;
+#endif
+}
+
+/* Per-context dispatch
+ *
+ * A GladGLContext holds its own copy of every entry point, loaded from
+ * whichever context is current when gladCreateGLContext() runs. Binding a
+ * table with gladMakeGLContextCurrent() is per thread: the glad_gl*
+ * pointers are switched once to trampolines that jump through the calling
+ * thread's current table, so several contexts (even from different
+ * drivers) can render on several threads with plain glFoo() calls.
+ *
+ * Once the trampolines are in, every glad_gl* pointer is non-NULL whether
+ * or not the bound table has the entry point, so availability has to be
+ * asked of gladGLProc(), and gladHasExtension() / gladGetExtensionProc()
+ * answer for the calling thread's table. GLVersion and GLAD_GL_VERSION_*
+ * stay process-wide: they describe the oldest table bound so far, so a
+ * version check passes only where every bound context can take the path.
+ * Bind every table before any thread relies on them.
+ */
+struct GladGLContext {
+    void *procs[GLAD_PROC_COUNT]; /* must stay first, trampolines index from offset 0 */
+    int major;
+    int minor;
+    glad_ext_set exts;
+    GLADloadproc load;
+};
+
+static int find_proc_index(const char *name) {
+    int low = 0, high = GLAD_PROC_COUNT - 1;
+
+    while(low <= high) {
+        int middle = (low + high) / 2;
+        int order = strcmp(glad_proc_table[middle].name, name);
+        if(order == 0) return middle;
+        if(order < 0) low = middle + 1;
+        else high = middle - 1;
+    }
+    return -1;
+}
+
+static void set_global_version(const GladGLContext *context) {
+    int index;
+
+    GLVersion.major = context->major; GLVersion.minor = context->minor;
+    max_loaded_major = context->major; max_loaded_minor = context->minor;
+    for(index = 0; index < GLAD_VERSION_COUNT; index++) {
+        *glad_version_flags[index] = glad_version_numbers[index] <= context->major * 10 + context->minor;
+    }
+}
+
+#ifdef GLAD_HAS_TRAMPOLINES
+/* 32 byte trampolines, number i jumps through procs[i] of the thread's table */
+GLAD_HIDDEN __thread GladGLContext *glad_current_context = NULL;
+GLAD_HIDDEN extern const char glad_dispatch_stubs[];
+
+__asm__(
+    ".text\n"
+    ".p2align 5\n"
+    ".globl glad_dispatch_stubs\n"
+    ".hidden glad_dispatch_stubs\n"
+    "glad_dispatch_stubs:\n"
+    ".set glad_dispatch_index, 0\n"
+    ".rept " GLAD_STRINGIFY(GLAD_PROC_COUNT) "\n"
+    "    movq glad_current_context@gottpoff(%rip), %r11\n"
+    "    movq %fs:(%r11), %r11\n"
+    "    jmp *(glad_dispatch_index * 8)(%r11)\n"
+    "    .p2align 5\n"
+    "    .set glad_dispatch_index, glad_dispatch_index + 1\n"
+    ".endr\n"
+);
+
+/* Set once the glad_gl* pointers are the trampolines. Written with release
+ * under the lock after the pointer stores, read with acquire, so a thread
+ * that sees it set also sees the trampolines. */
+static int glad_dispatch_installed = 0;
+static pthread_mutex_t glad_dispatch_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+GladGLContext *gladCreateGLContext(GLADloadproc load) {
+    GladGLContext *context;
+    PFNGLGETSTRINGPROC get_string;
+    int index, version, major, minor;
+
+    get_string = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(get_string == NULL) return NULL;
+    if(!parse_version((const char *)get_string(GL_VERSION), &major, &minor)) return NULL;
+
+    context = (GladGLContext *)calloc(1, sizeof(GladGLContext));
+    if(context == NULL) return NULL;
+    context->major = major;
+    context->minor = minor;
+    context->load = load;
+
+    version = major * 10 + minor;
+    for(index = 0; index < GLAD_PROC_COUNT; index++) {
+        const glad_proc_entry *entry = &glad_proc_table[index];
+
+        if(glad_version_numbers[entry->version] <= version) {
+            context->procs[index] = load(entry->name);
+        }
+    }
+
+    if(!get_exts(&context->exts, major,
+        (PFNGLGETSTRINGPROC)context->procs[find_proc_index("glGetString")],
+        (PFNGLGETINTEGERVPROC)context->procs[find_proc_index("glGetIntegerv")],
+        (PFNGLGETSTRINGIPROC)context->procs[find_proc_index("glGetStringi")])) {
+        free(context);
+        return NULL;
+    }
+
+    return context;
+}
+
+void gladDestroyGLContext(GladGLContext *context) {
+    if(context == NULL) return;
+#ifdef GLAD_HAS_TRAMPOLINES
+    if(glad_current_context == context) glad_current_context = NULL;
+#endif
+    free_exts(&context->exts);
+    free(context);
+}
+
+int gladMakeGLContextCurrent(GladGLContext *context) {
+#ifdef GLAD_HAS_TRAMPOLINES
+    /* The first bind switches all glad_gl* pointers to the trampolines, later
+     * ones only lower the process-wide version to the oldest table */
+    if(context != NULL) {
+        pthread_mutex_lock(&glad_dispatch_lock);
+        if(!glad_dispatch_installed) {
+            int index;
+
+            for(index = 0; index < GLAD_PROC_COUNT; index++) {
+                *glad_proc_table[index].proc = (void*)(glad_dispatch_stubs + 32 * index);
+            }
+            set_global_version(context);
+            __atomic_store_n(&glad_dispatch_installed, 1, __ATOMIC_RELEASE);
+        } else if(context->major * 10 + context->minor < GLVersion.major * 10 + GLVersion.minor) {
+            set_global_version(context);
+        }
+        pthread_mutex_unlock(&glad_dispatch_lock);
+    }
+    glad_current_context = context;
+    return 1;
+#else
+    /* No trampolines: copy the table into the globals. Only correct while
+     * a single thread renders at a time. */
+    int index;
+
+    if(context == NULL) return 0;
+    for(index = 0; index < GLAD_PROC_COUNT; index++) {
+        *glad_proc_table[index].proc = context->procs[index];
+    }
+    set_global_version(context);
+    return 0;
+#endif
+}
+
+void gladGLContextVersion(const GladGLContext *context, int *major, int *minor) {
+    *major = context->major;
+    *minor = context->minor;
+}
+
+int gladGLContextHasExtension(const GladGLContext *context, const char *name) {
+    return find_ext(&context->exts, name);
+}
+
+void *gladGLContextProc(const GladGLContext *context, const char *name) {
+    int index = find_proc_index(name);
+    return index < 0 ? NULL : context->procs[index];
+}
+
+/* Table bound on the calling thread under per-context dispatch, else NULL */
+static GladGLContext *glad_bound_context(void) {
+#ifdef GLAD_HAS_TRAMPOLINES
+    if(__atomic_load_n(&glad_dispatch_installed, __ATOMIC_ACQUIRE)) return glad_current_context;
+#endif
+    return NULL;
+}
+
+int gladHasExtension(const char *name) {
+    GladGLContext *context = glad_bound_context();
+    return context != NULL ? find_ext(&context->exts, name) : has_ext(name);
+}
+
+int gladExtensionCount(void) {
+    GladGLContext *context = glad_bound_context();
+    return context != NULL ? context->exts.count : exts.count;
+}
+
+void *gladGetExtensionProc(const char *name) {
+    GladGLContext *context = glad_bound_context();
+    GLADloadproc load = context != NULL ? context->load : glad_last_loader;
+    return load != NULL ? load(name) : NULL;
+}
+
+void *gladGLProc(const char *name) {
+    int index = find_proc_index(name);
+
+    if(index < 0) return NULL;
+#ifdef GLAD_HAS_TRAMPOLINES
+    /* Every pointer is a trampoline now, what counts is the table's slot */
+    if(__atomic_load_n(&glad_dispatch_installed, __ATOMIC_ACQUIRE)) {
+        return glad_current_context != NULL ? glad_current_context->procs[index] : NULL;
+    }
+#endif
+    return *glad_proc_table[index].proc;
+}
+
+void gladSetGLProc(const char *name, void *proc) {
+    int index = find_proc_index(name);
+    GladGLContext *context;
+
+    if(index < 0) return;
+    /* Under per-context dispatch the trampoline jumps through the table */
+    context = glad_bound_context();
+    if(context != NULL) context->procs[index] = proc;
+    else *glad_proc_table[index].proc = proc;
+}
+
+void *gladResolveGLProc(const char *name) {
+    int index = find_proc_index(name);
+
+    if(index < 0) return NULL;
+#ifdef GLAD_HAS_TRAMPOLINES
+    {
+        const char *proc = (const char *)*glad_proc_table[index].proc;
+        if(proc >= glad_lazy_stubs && proc < glad_lazy_stubs + 16 * GLAD_PROC_COUNT) {
+            return glad_lazy_resolve((unsigned int)index);
+        }
+    }
+#endif
+    return *glad_proc_table[index].proc;
+}
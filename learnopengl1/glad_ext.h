@@ -0,0 +1,71 @@
+#ifndef GLAD_EXT_H
+#define GLAD_EXT_H
+
+/* Additions to the generated glad loader in glad.c that are not part of
+ * the upstream glad.h. */
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Like gladLoadGLLoader, but every entry point is resolved on its first call.
+ * The loader must stay usable (and its context current) until then.
+ * Falls back to eager loading where no trampolines are available. */
+int gladLoadGLLoaderLazy(GLADloadproc load);
+
+/* Number of entry points resolved so far by the lazy loader */
+int gladLazyResolvedCount(void);
+
+/* Current value of the glad_gl* pointer for name, resolving it first if it
+ * is still a lazy trampoline. Code that wraps glad pointers saves this, so
+ * a later lazy resolve cannot overwrite the wrapper. */
+void *gladResolveGLProc(const char *name);
+
+/* O(1) check against the extension set captured by the last load, or of
+ * the calling thread's table under per-context dispatch.
+ * Stays valid for as long as the loaded context is used. */
+int gladHasExtension(const char *name);
+
+/* Number of distinct extensions the context reported */
+int gladExtensionCount(void);
+
+/* Entry point the generated loader does not know (extension functions),
+ * looked up with the loader of the last gladLoadGLLoader* call (or the one
+ * the calling thread's table was created with). NULL if the driver does not
+ * export it; check gladHasExtension() before calling. */
+void *gladGetExtensionProc(const char *name);
+
+/* What glFoo() reaches on the calling thread, NULL if it isn't loaded.
+ * Use this rather than comparing glad_glFoo against NULL: under per-context
+ * dispatch every glad_gl* pointer is a trampoline. */
+void *gladGLProc(const char *name);
+
+/* Fill in an entry point the loader left out (e.g. from an extension) for
+ * the calling thread's table, or process-wide without per-context dispatch */
+void gladSetGLProc(const char *name, void *proc);
+
+/* Per-context dispatch table, see glad.c */
+typedef struct GladGLContext GladGLContext;
+
+/* Load a table from the context that is current on the calling thread */
+GladGLContext *gladCreateGLContext(GLADloadproc load);
+void gladDestroyGLContext(GladGLContext *context);
+
+/* Route glFoo() calls made by the calling thread through this table.
+ * Returns 0 if the binding had to be made process-wide instead (no
+ * trampolines on this target), in which case only one thread may render. */
+int gladMakeGLContextCurrent(GladGLContext *context);
+
+void gladGLContextVersion(const GladGLContext *context, int *major, int *minor);
+int gladGLContextHasExtension(const GladGLContext *context, const char *name);
+
+/* Entry point of this table by name, for code that passes contexts explicitly */
+void *gladGLContextProc(const GladGLContext *context, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,208 @@
+#include "headless.h"
+
+#include <iostream>
+#include <cstring>
+#include <mutex>
+#include <glad/glad.h>
+
+#if defined(__linux__)
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+// Every context shares the one display, and eglTerminate would tear it down
+// for all of them, so only the last context to go away terminates it
+static std::mutex displayMutex;
+static int displayUsers = 0;
+
+static void releaseDisplay(EGLDisplay display)
+{
+	std::lock_guard<std::mutex> lock(displayMutex);
+	if (--displayUsers == 0)
+		eglTerminate(display);
+}
+
+// Pick the Mesa surfaceless platform when the client supports it, so no
+// X11/Wayland connection or DRM device is needed at all
+static EGLDisplay getHeadlessDisplay()
+{
+	const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+	if (clientExtensions != NULL && strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL)
+	{
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+			(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay != NULL)
+			return getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	}
+
+	return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+bool createHeadlessContext(HeadlessContext& headless, int width, int height)
+{
+	headless.display = NULL;
+	headless.context = NULL;
+	headless.FBO = 0;
+	headless.colorRBO = 0;
+	headless.width = width;
+	headless.height = height;
+
+	EGLDisplay display;
+	{
+		std::lock_guard<std::mutex> lock(displayMutex);
+		display = getHeadlessDisplay();
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_INITIALIZE_FAILED" << std::endl;
+			return false;
+		}
+		displayUsers++;
+	}
+
+	// We never create an EGL surface, so the config only has to support desktop GL
+	const EGLint configAttribs[] = {
+		EGL_SURFACE_TYPE, 0,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE
+	};
+	EGLConfig config;
+	EGLint numConfigs = 0;
+	if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+	{
+		std::cout << "ERROR::HEADLESS::NO_EGL_CONFIG" << std::endl;
+		releaseDisplay(display);
+		return false;
+	}
+
+	if (!eglBindAPI(EGL_OPENGL_API))
+	{
+		std::cout << "ERROR::HEADLESS::OPENGL_API_UNAVAILABLE" << std::endl;
+		releaseDisplay(display);
+		return false;
+	}
+
+	// Same 3.3 core context the windowed path asks GLFW for
+	const EGLint contextAttribs[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+	EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+	if (context == EGL_NO_CONTEXT)
+	{
+		std::cout << "ERROR::HEADLESS::CONTEXT_CREATION_FAILED" << std::endl;
+		releaseDisplay(display);
+		return false;
+	}
+
+	// Needs EGL_KHR_surfaceless_context, which every Mesa driver exposes
+	if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+	{
+		std::cout << "ERROR::HEADLESS::MAKE_CURRENT_FAILED" << std::endl;
+		eglDestroyContext(display, context);
+		releaseDisplay(display);
+		return false;
+	}
+
+	headless.display = display;
+	headless.context = context;
+	return true;
+}
+
+void destroyHeadlessContext(HeadlessContext& headless)
+{
+	if (headless.context == NULL)
+		return;
+
+	if (headless.FBO != 0)
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glDeleteFramebuffers(1, &headless.FBO);
+		glDeleteRenderbuffers(1, &headless.colorRBO);
+		headless.FBO = 0;
+		headless.colorRBO = 0;
+	}
+
+	eglMakeCurrent(headless.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	eglDestroyContext(headless.display, headless.context);
+	releaseDisplay(headless.display);
+	headless.context = NULL;
+	headless.display = NULL;
+}
+
+bool makeHeadlessContextCurrent(HeadlessContext& headless)
+{
+	if (!eglMakeCurrent(headless.display, EGL_NO_SURFACE, EGL_NO_SURFACE, headless.context))
+	{
+		std::cout << "ERROR::HEADLESS::MAKE_CURRENT_FAILED" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void releaseHeadlessContext(HeadlessContext& headless)
+{
+	eglMakeCurrent(headless.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void* headlessGetProcAddress(const char* name)
+{
+	return (void*)eglGetProcAddress(name);
+}
+
+#else
+
+bool createHeadlessContext(HeadlessContext& headless, int width, int height)
+{
+	headless.display = NULL;
+	headless.context = NULL;
+	headless.FBO = 0;
+	headless.colorRBO = 0;
+	headless.width = width;
+	headless.height = height;
+
+	std::cout << "ERROR::HEADLESS::UNSUPPORTED_PLATFORM" << std::endl;
+	return false;
+}
+
+void destroyHeadlessContext(HeadlessContext&)
+{
+}
+
+bool makeHeadlessContextCurrent(HeadlessContext&)
+{
+	return false;
+}
+
+void releaseHeadlessContext(HeadlessContext&)
+{
+}
+
+void* headlessGetProcAddress(const char*)
+{
+	return NULL;
+}
+
+#endif
+
+bool createHeadlessTarget(HeadlessContext& headless)
+{
+	// A single color renderbuffer is enough, the scene has no depth
+	glGenRenderbuffers(1, &headless.colorRBO);
+	glBindRenderbuffer(GL_RENDERBUFFER, headless.colorRBO);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, headless.width, headless.height);
+
+	glGenFramebuffers(1, &headless.FBO);
+	glBindFramebuffer(GL_FRAMEBUFFER, headless.FBO);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headless.colorRBO);
+
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "ERROR::HEADLESS::FRAMEBUFFER_INCOMPLETE" << std::endl;
+		return false;
+	}
+
+	// Leave the FBO bound, all following draws go into it
+	return true;
+}
@@ -0,0 +1,35 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+// Offscreen rendering for machines without a display.
+// A surfaceless EGL context is created (Mesa llvmpipe works without a GPU)
+// and everything is drawn into a framebuffer object of the requested size
+// instead of a window.
+struct HeadlessContext
+{
+	void* display;
+	void* context;
+	unsigned int FBO;
+	unsigned int colorRBO;
+	int width;
+	int height;
+};
+
+// Create the EGL context and make it current on the calling thread
+bool createHeadlessContext(HeadlessContext& headless, int width, int height);
+
+// Create and bind the offscreen render target (needs GL functions loaded)
+bool createHeadlessTarget(HeadlessContext& headless);
+
+// Delete the render target and release the EGL context
+void destroyHeadlessContext(HeadlessContext& headless);
+
+// Move the context between threads: release it on the one that has it
+// current, then make it current on the other
+bool makeHeadlessContextCurrent(HeadlessContext& headless);
+void releaseHeadlessContext(HeadlessContext& headless);
+
+// Loader function to hand to gladLoadGLLoader
+void* headlessGetProcAddress(const char* name);
+
+#endif
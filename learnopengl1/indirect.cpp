@@ -0,0 +1,337 @@
+#include "indirect.h"
+
+#include <cmath>
+#include <cstddef>
+#include <glad/glad.h>
+#include "glad_ext.h"
+#include "shader.h"
+
+// Same per-instance attributes as InstancedMesh. With multi-draw each command
+// is one instance whose baseInstance is the draw's index, so the divisor
+// attributes fetch that draw's data. The CPU loop leaves the arrays off and
+// sets the values as constant attributes instead.
+static const char* indirectVertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec4 aTransform;\n"
+	"layout (location = 2) in vec2 aOffset;\n"
+	"layout (location = 3) in vec4 aColor;\n"
+	"out vec4 color;\n"
+	"void main()\n"
+	"{\n"
+	"	color = aColor;\n"
+	"	gl_Position = vec4(mat2(aTransform.xy, aTransform.zw) * aPos.xy + aOffset, aPos.z, 1.0);\n"
+	"}\0";
+
+static const char* indirectFragmentSource = "#version 330 core\n"
+	"in vec4 color;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = color;\n"
+	"}\0";
+
+// One thread per draw: cull its bounding circle against the rectangle and
+// write its command, either in place with instanceCount 0 when culled, or
+// appended to a compacted list whose length ends up in drawCount
+static const char* cullComputeSource = "#version 430 core\n"
+	"layout (local_size_x = 64) in;\n"
+	"struct Draw { vec4 transform; vec2 offset; uint color; uint mesh; };\n"
+	"struct MeshInfo { vec4 bounds; uint count; uint firstIndex; int baseVertex; uint pad; };\n"
+	"struct Command { uint count; uint instanceCount; uint firstIndex; int baseVertex; uint baseInstance; };\n"
+	"layout (std430, binding = 0) readonly buffer Draws { Draw draws[]; };\n"
+	"layout (std430, binding = 1) readonly buffer Meshes { MeshInfo meshes[]; };\n"
+	"layout (std430, binding = 2) writeonly buffer Commands { Command commands[]; };\n"
+	"layout (std430, binding = 3) buffer Count { uint drawCount; };\n"
+	"uniform uint uDrawCount;\n"
+	"uniform vec4 uCullRect;\n"
+	"uniform bool uCompact;\n"
+	"void main()\n"
+	"{\n"
+	"	uint i = gl_GlobalInvocationID.x;\n"
+	"	if (i >= uDrawCount)\n"
+	"		return;\n"
+	"	Draw draw = draws[i];\n"
+	"	MeshInfo mesh = meshes[draw.mesh];\n"
+	"	vec2 center = mat2(draw.transform.xy, draw.transform.zw) * mesh.bounds.xy + draw.offset;\n"
+	"	float radius = mesh.bounds.w * max(length(draw.transform.xy), length(draw.transform.zw));\n"
+	"	bool visible = center.x + radius >= uCullRect.x && center.y + radius >= uCullRect.y &&\n"
+	"		center.x - radius <= uCullRect.z && center.y - radius <= uCullRect.w;\n"
+	"	Command command = Command(mesh.count, visible ? 1u : 0u, mesh.firstIndex, mesh.baseVertex, i);\n"
+	"	if (!uCompact)\n"
+	"		commands[i] = command;\n"
+	"	else if (visible)\n"
+	"		commands[atomicAdd(drawCount, 1u)] = command;\n"
+	"}\0";
+
+IndirectRenderer::IndirectRenderer()
+	: currentMode(INDIRECT_CPU_LOOP), lastVisible(0), commandCapacity(0), program(0), cullProgram(0),
+	VAO(0), VBO(0), EBO(0), drawBuffer(0), meshBuffer(0), commandBuffer(0), countBuffer(0)
+{
+	setCullRect(-1.0f, -1.0f, 1.0f, 1.0f);
+}
+
+const char* IndirectRenderer::modeName(IndirectMode mode)
+{
+	switch (mode)
+	{
+	case INDIRECT_GPU_CULL:
+		return "gpu-cull";
+	case INDIRECT_MULTI_DRAW:
+		return "multi-draw";
+	default:
+		return "cpu-loop";
+	}
+}
+
+int IndirectRenderer::addMesh(const IndexedMesh& mesh)
+{
+	MeshInfo info;
+	info.count = (unsigned int)mesh.indices.size();
+	info.firstIndex = (unsigned int)indices.size();
+	info.baseVertex = (int)(vertices.size() / 3);
+	info.pad = 0;
+
+	// Bounding circle in xy around the box center, which is what culling tests
+	float low[3] = { 0.0f, 0.0f, 0.0f };
+	float high[3] = { 0.0f, 0.0f, 0.0f };
+	for (size_t v = 0; v < mesh.vertexCount(); v++)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			float value = mesh.vertices[v * mesh.stride + k];
+			low[k] = v == 0 || value < low[k] ? value : low[k];
+			high[k] = v == 0 || value > high[k] ? value : high[k];
+		}
+		vertices.insert(vertices.end(), &mesh.vertices[v * mesh.stride], &mesh.vertices[v * mesh.stride] + 3);
+	}
+	info.bounds[0] = (low[0] + high[0]) * 0.5f;
+	info.bounds[1] = (low[1] + high[1]) * 0.5f;
+	info.bounds[2] = (low[2] + high[2]) * 0.5f;
+	info.bounds[3] = 0.0f;
+	for (size_t v = 0; v < mesh.vertexCount(); v++)
+	{
+		float dx = mesh.vertices[v * mesh.stride] - info.bounds[0];
+		float dy = mesh.vertices[v * mesh.stride + 1] - info.bounds[1];
+		float distance = sqrtf(dx * dx + dy * dy);
+		if (distance > info.bounds[3])
+			info.bounds[3] = distance;
+	}
+
+	indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+	meshes.push_back(info);
+	return (int)meshes.size() - 1;
+}
+
+bool IndirectRenderer::init(IndirectMode preferred)
+{
+	// Fall back one tier at a time to what the context can actually do
+	currentMode = preferred;
+	if (currentMode == INDIRECT_GPU_CULL && !GLAD_GL_VERSION_4_3)
+		currentMode = INDIRECT_MULTI_DRAW;
+	if (currentMode == INDIRECT_MULTI_DRAW && !GLAD_GL_VERSION_4_3)
+		currentMode = INDIRECT_CPU_LOOP;
+
+	program = createProgram(indirectVertexSource, indirectFragmentSource);
+	if (program == 0)
+		return false;
+	if (currentMode == INDIRECT_GPU_CULL)
+	{
+		cullProgram = createComputeProgram(cullComputeSource);
+		if (cullProgram == 0 || !cullUniforms.reflect(cullProgram))
+		{
+			glDeleteProgram(cullProgram);
+			cullProgram = 0;
+			currentMode = INDIRECT_MULTI_DRAW;
+		}
+	}
+
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+
+	glGenBuffers(1, &VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glGenBuffers(1, &EBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+	if (currentMode != INDIRECT_CPU_LOOP)
+	{
+		glGenBuffers(1, &drawBuffer);
+		glBindBuffer(GL_ARRAY_BUFFER, drawBuffer);
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Draw), (void*)offsetof(Instance, transform));
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Draw), (void*)offsetof(Instance, offset));
+		glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Draw), (void*)offsetof(Instance, color));
+		for (unsigned int attribute = 1; attribute <= 3; attribute++)
+		{
+			glEnableVertexAttribArray(attribute);
+			glVertexAttribDivisor(attribute, 1);
+		}
+
+		glGenBuffers(1, &commandBuffer);
+	}
+	glBindVertexArray(0);
+
+	if (currentMode == INDIRECT_GPU_CULL)
+	{
+		glGenBuffers(1, &meshBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, meshBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, meshes.size() * sizeof(MeshInfo), meshes.data(), GL_STATIC_DRAW);
+
+		glGenBuffers(1, &countBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, countBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(unsigned int), NULL, GL_DYNAMIC_DRAW);
+	}
+
+	// Culling only needs the mesh bounds, the geometry lives on the GPU now
+	std::vector<float>().swap(vertices);
+	std::vector<unsigned int>().swap(indices);
+	return true;
+}
+
+void IndirectRenderer::destroy()
+{
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	glDeleteBuffers(1, &EBO);
+	glDeleteBuffers(1, &drawBuffer);
+	glDeleteBuffers(1, &meshBuffer);
+	glDeleteBuffers(1, &commandBuffer);
+	glDeleteBuffers(1, &countBuffer);
+	glDeleteProgram(program);
+	glDeleteProgram(cullProgram);
+	VAO = VBO = EBO = 0;
+	drawBuffer = meshBuffer = commandBuffer = countBuffer = 0;
+	program = cullProgram = 0;
+	commandCapacity = 0;
+}
+
+void IndirectRenderer::setCullRect(float minX, float minY, float maxX, float maxY)
+{
+	cullRect[0] = minX;
+	cullRect[1] = minY;
+	cullRect[2] = maxX;
+	cullRect[3] = maxY;
+}
+
+void IndirectRenderer::begin()
+{
+	draws.clear();
+}
+
+void IndirectRenderer::add(int mesh, const Instance& instance)
+{
+	Draw draw = { instance, (unsigned int)mesh };
+	draws.push_back(draw);
+}
+
+bool IndirectRenderer::visible(const Draw& draw) const
+{
+	const MeshInfo& mesh = meshes[draw.mesh];
+	const float* m = draw.instance.transform;
+	float x = m[0] * mesh.bounds[0] + m[2] * mesh.bounds[1] + draw.instance.offset[0];
+	float y = m[1] * mesh.bounds[0] + m[3] * mesh.bounds[1] + draw.instance.offset[1];
+	float scale = fmaxf(sqrtf(m[0] * m[0] + m[1] * m[1]), sqrtf(m[2] * m[2] + m[3] * m[3]));
+	float radius = mesh.bounds[3] * scale;
+	return x + radius >= cullRect[0] && y + radius >= cullRect[1] && x - radius <= cullRect[2] && y - radius <= cullRect[3];
+}
+
+void IndirectRenderer::ensureCommandCapacity(size_t count)
+{
+	if (count <= commandCapacity)
+		return;
+
+	// Grow geometrically so a growing scene doesn't reallocate every frame
+	commandCapacity = count + count / 2;
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, commandCapacity * sizeof(Command), NULL, GL_STREAM_DRAW);
+}
+
+void IndirectRenderer::flush()
+{
+	lastVisible = 0;
+	if (draws.empty())
+		return;
+
+	glUseProgram(program);
+	glBindVertexArray(VAO);
+
+	if (currentMode == INDIRECT_CPU_LOOP)
+	{
+		for (size_t i = 0; i < draws.size(); i++)
+		{
+			const Draw& draw = draws[i];
+			if (!visible(draw))
+				continue;
+
+			const MeshInfo& mesh = meshes[draw.mesh];
+			const unsigned char* color = (const unsigned char*)&draw.instance.color;
+			glVertexAttrib4fv(1, draw.instance.transform);
+			glVertexAttrib2fv(2, draw.instance.offset);
+			glVertexAttrib4Nub(3, color[0], color[1], color[2], color[3]);
+			glDrawElementsBaseVertex(GL_TRIANGLES, mesh.count, GL_UNSIGNED_INT,
+				(void*)(mesh.firstIndex * sizeof(unsigned int)), mesh.baseVertex);
+			lastVisible++;
+		}
+		return;
+	}
+
+	// Per-draw data feeds both the instance attributes and the culling pass
+	glBindBuffer(GL_ARRAY_BUFFER, drawBuffer);
+	glBufferData(GL_ARRAY_BUFFER, draws.size() * sizeof(Draw), draws.data(), GL_STREAM_DRAW);
+	ensureCommandCapacity(draws.size());
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+
+	if (currentMode == INDIRECT_MULTI_DRAW)
+	{
+		commands.clear();
+		for (size_t i = 0; i < draws.size(); i++)
+		{
+			if (!visible(draws[i]))
+				continue;
+			const MeshInfo& mesh = meshes[draws[i].mesh];
+			Command command = { mesh.count, 1, mesh.firstIndex, mesh.baseVertex, (unsigned int)i };
+			commands.push_back(command);
+		}
+		lastVisible = (int)commands.size();
+		if (commands.empty())
+			return;
+
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commands.size() * sizeof(Command), commands.data());
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)0, (int)commands.size(), 0);
+		return;
+	}
+
+	// Compaction needs the draw count to come from a buffer (4.6), otherwise
+	// culled commands stay in place with no instances
+	bool compact = GLAD_GL_VERSION_4_6 && gladGLProc("glMultiDrawElementsIndirectCount") != NULL;
+	unsigned int zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, countBuffer);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zero), &zero);
+
+	glUseProgram(cullProgram);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, drawBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, meshBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, commandBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, countBuffer);
+	cullUniforms.setUint(shaderName("uDrawCount"), (unsigned int)draws.size());
+	cullUniforms.setVec4(shaderName("uCullRect"), cullRect);
+	cullUniforms.setInt(shaderName("uCompact"), compact ? 1 : 0);
+	glDispatchCompute((unsigned int)(draws.size() + 63) / 64, 1, 1);
+
+	// The draw below reads the commands (and count) the dispatch wrote
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+
+	glUseProgram(program);
+	if (compact)
+	{
+		glBindBuffer(GL_PARAMETER_BUFFER, countBuffer);
+		glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)0, 0, (int)draws.size(), 0);
+	}
+	else
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)0, (int)draws.size(), 0);
+	lastVisible = -1;
+}
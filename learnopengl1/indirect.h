@@ -0,0 +1,105 @@
+#ifndef INDIRECT_H
+#define INDIRECT_H
+
+#include <vector>
+#include "instancing.h"
+#include "mesh.h"
+#include "program_reflection.h"
+
+// How a frame's draws reach the GPU, best first. init() picks the best one
+// the context supports, so 3.3 contexts end up on the CPU loop.
+enum IndirectMode
+{
+	// 4.3: a compute pass culls and writes the commands, one multi-draw
+	// (4.6 also compacts them and draws with the GPU written count)
+	INDIRECT_GPU_CULL,
+	// 4.3: commands culled and written on the CPU, one multi-draw
+	INDIRECT_MULTI_DRAW,
+	// 3.3: one glDrawElementsBaseVertex per visible draw
+	INDIRECT_CPU_LOOP
+};
+
+// Draws many objects from a few meshes that all live in one vertex and one
+// index buffer, so the whole scene can be described as a list of indirect
+// draw commands and submitted at once.
+class IndirectRenderer
+{
+public:
+	IndirectRenderer();
+
+	// Append a mesh before init (only its positions are used), returns its id
+	int addMesh(const IndexedMesh& mesh);
+
+	// Upload the meshes and set up the best mode no better than preferred
+	bool init(IndirectMode preferred = INDIRECT_GPU_CULL);
+	void destroy();
+
+	IndirectMode mode() const { return currentMode; }
+	static const char* modeName(IndirectMode mode);
+
+	// Draws whose bounds are entirely outside this rectangle (clip space by
+	// default) are culled
+	void setCullRect(float minX, float minY, float maxX, float maxY);
+
+	void begin();
+	void add(int mesh, const Instance& instance);
+
+	// Cull and draw everything added since begin()
+	void flush();
+
+	size_t drawCount() const { return draws.size(); }
+
+	// Draws that survived culling last flush, -1 when the GPU culled them
+	int visibleCount() const { return lastVisible; }
+
+private:
+	// Mirrors the std430 layouts in the culling shader
+	struct Draw
+	{
+		Instance instance;
+		unsigned int mesh;
+	};
+	struct MeshInfo
+	{
+		float bounds[4];
+		unsigned int count;
+		unsigned int firstIndex;
+		int baseVertex;
+		unsigned int pad;
+	};
+	struct Command
+	{
+		unsigned int count;
+		unsigned int instanceCount;
+		unsigned int firstIndex;
+		int baseVertex;
+		unsigned int baseInstance;
+	};
+
+	bool visible(const Draw& draw) const;
+	void ensureCommandCapacity(size_t count);
+
+	std::vector<float> vertices;
+	std::vector<unsigned int> indices;
+	std::vector<MeshInfo> meshes;
+	std::vector<Draw> draws;
+	std::vector<Command> commands;
+	IndirectMode currentMode;
+	float cullRect[4];
+	int lastVisible;
+	size_t commandCapacity;
+
+	unsigned int program;
+	unsigned int cullProgram;
+	// Uniforms of cullProgram, reflected once at init
+	ProgramReflection cullUniforms;
+	unsigned int VAO;
+	unsigned int VBO;
+	unsigned int EBO;
+	unsigned int drawBuffer;
+	unsigned int meshBuffer;
+	unsigned int commandBuffer;
+	unsigned int countBuffer;
+};
+
+#endif
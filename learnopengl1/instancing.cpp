@@ -0,0 +1,125 @@
+#include "instancing.h"
+
+#include <cstddef>
+#include <cstring>
+#include <glad/glad.h>
+#include "shader.h"
+
+static const char* instanceVertexSource = "#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec4 aTransform;\n"
+	"layout (location = 2) in vec2 aOffset;\n"
+	"layout (location = 3) in vec4 aColor;\n"
+	"out vec4 color;\n"
+	"void main()\n"
+	"{\n"
+	"	color = aColor;\n"
+	"	gl_Position = vec4(mat2(aTransform.xy, aTransform.zw) * aPos.xy + aOffset, aPos.z, 1.0);\n"
+	"}\0";
+
+static const char* instanceFragmentSource = "#version 330 core\n"
+	"in vec4 color;\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = color;\n"
+	"}\0";
+
+Instance makeInstance(float x, float y, float scaleX, float scaleY, unsigned int color)
+{
+	Instance instance = { { scaleX, 0.0f, 0.0f, scaleY }, { x, y }, color };
+	return instance;
+}
+
+InstancedMesh::InstancedMesh(size_t maxInstances)
+	: capacity(maxInstances > 0 ? maxInstances : 1), vertexCount(0), indexCount(0), program(0), VAO(0), meshVBO(0), EBO(0),
+	stream(GL_ARRAY_BUFFER, capacity * sizeof(Instance))
+{
+}
+
+bool InstancedMesh::init(const float* positions, int vertexCount, const unsigned int* indices, int indexCount)
+{
+	program = createProgram(instanceVertexSource, instanceFragmentSource);
+	if (program == 0)
+		return false;
+
+	this->vertexCount = vertexCount;
+	this->indexCount = indices != NULL ? indexCount : 0;
+
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+
+	// The mesh itself never changes
+	glGenBuffers(1, &meshVBO);
+	glBindBuffer(GL_ARRAY_BUFFER, meshVBO);
+	glBufferData(GL_ARRAY_BUFFER, vertexCount * 3 * sizeof(float), positions, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	if (this->indexCount > 0)
+	{
+		glGenBuffers(1, &EBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+	}
+
+	// Per-instance attributes advance once per instance instead of per vertex,
+	// flush points them at wherever this frame's instances were written
+	stream.init();
+	for (unsigned int attribute = 1; attribute <= 3; attribute++)
+	{
+		glEnableVertexAttribArray(attribute);
+		glVertexAttribDivisor(attribute, 1);
+	}
+
+	glBindVertexArray(0);
+	return true;
+}
+
+void InstancedMesh::destroy()
+{
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &meshVBO);
+	glDeleteBuffers(1, &EBO);
+	stream.destroy();
+	glDeleteProgram(program);
+	VAO = 0;
+	meshVBO = 0;
+	EBO = 0;
+	program = 0;
+}
+
+void InstancedMesh::begin()
+{
+	instances.clear();
+}
+
+void InstancedMesh::flush()
+{
+	if (instances.empty())
+		return;
+
+	glUseProgram(program);
+	glBindVertexArray(VAO);
+
+	for (size_t first = 0; first < instances.size(); first += capacity)
+	{
+		size_t count = instances.size() - first < capacity ? instances.size() - first : capacity;
+
+		size_t offset;
+		void* destination = stream.map(count * sizeof(Instance), sizeof(float), offset);
+		memcpy(destination, &instances[first], count * sizeof(Instance));
+		stream.unmap();
+
+		// Base instance needs 4.2, so move the attribute pointers instead
+		glBindBuffer(GL_ARRAY_BUFFER, stream.buffer());
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, transform)));
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, offset)));
+		glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (void*)(offset + offsetof(Instance, color)));
+
+		if (indexCount > 0)
+			glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0, (int)count);
+		else
+			glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, (int)count);
+	}
+}
@@ -0,0 +1,56 @@
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include <cstddef>
+#include <vector>
+#include "stream_buffer.h"
+
+// Placement of one copy of the mesh: position' = transform * position.xy + offset,
+// with transform a column-major 2x2 matrix (a negative scale mirrors)
+struct Instance
+{
+	float transform[4];
+	float offset[2];
+	unsigned int color;
+};
+
+// Instance with the given scale and offset and no rotation
+Instance makeInstance(float x, float y, float scaleX, float scaleY, unsigned int color);
+
+// A mesh uploaded once and drawn any number of times per frame in a single
+// instanced call. Per-instance transforms and colors are streamed into their
+// own StreamBuffer each frame and fed through attribute divisors.
+class InstancedMesh
+{
+public:
+	// maxInstances is the size of one streaming region and caps a single
+	// draw; more instances are drawn in several calls
+	InstancedMesh(size_t maxInstances = 1 << 18);
+
+	// positions holds x, y, z per vertex. With indices the mesh is drawn
+	// with glDrawElementsInstanced, otherwise glDrawArraysInstanced.
+	bool init(const float* positions, int vertexCount, const unsigned int* indices = NULL, int indexCount = 0);
+	void destroy();
+
+	void begin();
+	void add(const Instance& instance) { instances.push_back(instance); }
+
+	// Upload this frame's instances and draw them all
+	void flush();
+
+	size_t instanceCount() const { return instances.size(); }
+
+private:
+	std::vector<Instance> instances;
+	size_t capacity;
+	int vertexCount;
+	int indexCount;
+
+	unsigned int program;
+	unsigned int VAO;
+	unsigned int meshVBO;
+	unsigned int EBO;
+	StreamBuffer stream;
+};
+
+#endif
@@ -0,0 +1,141 @@
+#include "job_system.h"
+
+JobSystem::JobSystem(int threadCount)
+	: queued(0), stealCount(0), stopping(false)
+{
+	if (threadCount <= 0)
+		threadCount = (int)std::thread::hardware_concurrency();
+	if (threadCount <= 0)
+		threadCount = 1;
+
+	for (int i = 0; i < threadCount; i++)
+		queues.push_back(new WorkQueue());
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(&JobSystem::workerLoop, this, i));
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	for (size_t i = 0; i < queues.size(); i++)
+		delete queues[i];
+}
+
+void JobSystem::push(JobFunction function, void* data, int begin, int end, JobCounter& counter, int worker)
+{
+	Job job;
+	job.function = function;
+	job.data = data;
+	job.begin = begin;
+	job.end = end;
+	job.counter = &counter;
+
+	counter.pending++;
+	WorkQueue* queue = queues[worker % queues.size()];
+	{
+		std::lock_guard<std::mutex> lock(queue->mutex);
+		queue->jobs.push_back(job);
+	}
+
+	// Taking the sleep lock orders this against a worker about to sleep
+	queued++;
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+	}
+	wake.notify_one();
+}
+
+bool JobSystem::take(int worker, Job& job)
+{
+	if (queued.load() == 0)
+		return false;
+
+	// Own queue from the back
+	WorkQueue* own = queues[worker];
+	{
+		std::lock_guard<std::mutex> lock(own->mutex);
+		if (!own->jobs.empty())
+		{
+			job = own->jobs.back();
+			own->jobs.pop_back();
+			queued--;
+			return true;
+		}
+	}
+
+	// Everyone else's from the front
+	for (size_t i = 1; i < queues.size(); i++)
+	{
+		WorkQueue* victim = queues[(worker + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim->mutex);
+		if (!victim->jobs.empty())
+		{
+			job = victim->jobs.front();
+			victim->jobs.pop_front();
+			queued--;
+			stealCount++;
+			return true;
+		}
+	}
+	return false;
+}
+
+void JobSystem::run(const Job& job, int worker)
+{
+	job.function(job.data, job.begin, job.end, worker);
+	job.counter->pending--;
+}
+
+void JobSystem::workerLoop(int worker)
+{
+	for (;;)
+	{
+		Job job;
+		if (take(worker, job))
+		{
+			run(job, worker);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+		if (stopping)
+			return;
+	}
+}
+
+void JobSystem::wait(JobCounter& counter)
+{
+	while (counter.pending.load() > 0)
+	{
+		Job job;
+		if (take(0, job))
+			run(job, 0);
+		else
+			std::this_thread::yield();
+	}
+}
+
+void JobSystem::parallelFor(int count, int grain, JobFunction function, void* data)
+{
+	if (grain <= 0)
+		grain = 1;
+
+	// Round robin over the queues, so every worker starts on its own jobs
+	// and only steals once it runs dry
+	JobCounter counter;
+	int queue = 0;
+	for (int begin = 0; begin < count; begin += grain)
+	{
+		int end = begin + grain < count ? begin + grain : count;
+		push(function, data, begin, end, counter, queue);
+		queue = (queue + 1) % (int)queues.size();
+	}
+	wait(counter);
+}
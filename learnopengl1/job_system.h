@@ -0,0 +1,83 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs a job over the range [begin, end); worker is the index of the thread
+// running it (0 is the thread that owns the system), for per-thread output
+typedef void (*JobFunction)(void* data, int begin, int end, int worker);
+
+// Jobs of one batch still to finish
+struct JobCounter
+{
+	std::atomic<int> pending;
+
+	JobCounter() : pending(0) {}
+};
+
+// Fixed pool of threads sharing jobs by work stealing.
+//
+// Every thread has its own queue. A thread runs the newest job of its own
+// queue first (its data is most likely still in cache) and, when that is
+// empty, steals the oldest job from another queue, which tends to be the
+// biggest piece of work left. Idle workers sleep until jobs are pushed.
+//
+// The thread that creates the system is worker 0: it pushes jobs and,
+// while waiting for them, runs jobs too instead of blocking. Only that
+// thread may push and wait, so it is where the GL context lives.
+class JobSystem
+{
+public:
+	// threads counts the owning thread; 0 for one per hardware thread
+	JobSystem(int threads = 0);
+	~JobSystem();
+
+	// Queue one job on worker's queue (others steal it if they're idle)
+	void push(JobFunction function, void* data, int begin, int end, JobCounter& counter, int worker = 0);
+
+	// Run jobs until every job of the counter has finished
+	void wait(JobCounter& counter);
+
+	// Split [0, count) into jobs of at most grain items, spread them over
+	// all queues, and wait for them
+	void parallelFor(int count, int grain, JobFunction function, void* data);
+
+	int threadCount() const { return (int)queues.size(); }
+
+	// Jobs taken from another thread's queue so far
+	int steals() const { return stealCount.load(); }
+
+private:
+	struct Job
+	{
+		JobFunction function;
+		void* data;
+		int begin;
+		int end;
+		JobCounter* counter;
+	};
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	bool take(int worker, Job& job);
+	void run(const Job& job, int worker);
+	void workerLoop(int worker);
+
+	std::vector<WorkQueue*> queues;
+	std::vector<std::thread> threads;
+	std::atomic<int> queued;
+	std::atomic<int> stealCount;
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+	bool stopping;
+};
+
+#endif
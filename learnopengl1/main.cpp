@@ -1,35 +1,137 @@
 #include <iostream>
-#include <glad\glad.h>
-#include <GLFW\glfw3.h>
-
-// string with fragment shader code
-const char* fragmentShader1Source = "#version 330 core\n"
-	"out vec4 FragColor;\n"
-	"void main()\n"
-	"{\n"
-	"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-	"}\0";
-
-const char* fragmentShader2Source = "#version 330 core\n"
-	"out vec4 FragColor;\n"
-	"void main()\n"
-	"{\n"
-	"	FragColor = vec4(0.9f, 0.9f, 0.1f, 1.0f);\n"
-	"}\0";
-
-// string with our vertex shader code
-const char* vertexShaderSource = "#version 330 core\n"
-    "layout (location = 0) in vec3 aPos;\n"
-    "void main()\n"
-    "{\n"
-    "   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-	"}\0";
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "batcher.h"
+#include "dynamic_resolution.h"
+#include "frame_pacer.h"
+#include "frame_timer.h"
+#include "gl_trace.h"
+#include "glad_ext.h"
+#include "headless.h"
+#include "indirect.h"
+#include "instancing.h"
+#include "material_system.h"
+#include "program_cache.h"
+#include "render_queue.h"
+#include "scene.h"
+#include "shader_variants.h"
+#include "spsc_queue.h"
+#include "state_cache.h"
+
+// Why the next frame has to be drawn, in on-demand mode
+struct RedrawState
+{
+	bool dirty;
+	// Something changes every frame, so the loop never idles
+	bool animating;
+	int skipped;
+
+	RedrawState() : dirty(true), animating(false), skipped(0) {}
+};
+
+// What the callbacks of the inline loop reach through the window user pointer
+struct WindowState
+{
+	RedrawState* redraw;
+	DynamicResolution* resolution;
+};
 
 // Function to call when window is resized
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-	glViewport(0, 0, width, height);
+	// With dynamic resolution the viewport is set every frame instead
+	WindowState* state = (WindowState*)glfwGetWindowUserPointer(window);
+	if (state != NULL && state->resolution != NULL)
+		state->resolution->resize(width, height);
+	else
+		glViewport(0, 0, width, height);
+
+	if (state != NULL && state->redraw != NULL)
+		state->redraw->dirty = true;
+}
+
+// Any key may change what is drawn, and the window system asks for a
+// refresh when part of the window was uncovered (on-demand mode only)
+void redrawKeyCallback(GLFWwindow* window, int, int, int, int)
+{
+	((WindowState*)glfwGetWindowUserPointer(window))->redraw->dirty = true;
+}
+
+void redrawRefreshCallback(GLFWwindow* window)
+{
+	((WindowState*)glfwGetWindowUserPointer(window))->redraw->dirty = true;
+}
+
+enum InputEventType
+{
+	INPUT_KEY,
+	INPUT_RESIZE
+};
+
+// Window input passed from the event thread to the render thread
+struct InputEvent
+{
+	InputEventType type;
+	int key;
+	int action;
+	int width;
+	int height;
+	// Seconds since the render loop started, taken when the event came in
+	double time;
+};
+
+// What the render thread tells the event thread about every frame
+struct FrameReport
+{
+	int frame;
+	// Oldest input the frame handled (negative if none) and when it was presented
+	double inputTime;
+	double presentTime;
+};
+
+// Shared by the event thread and the render thread with --render-thread
+struct RenderThreadLink
+{
+	SpscQueue<InputEvent> events;
+	SpscQueue<FrameReport> reports;
+	std::atomic<bool> stop;
+	std::atomic<bool> finished;
+	std::chrono::steady_clock::time_point start;
+	// Written by the event thread only
+	int droppedEvents;
+
+	RenderThreadLink() : events(1024), reports(256), stop(false), finished(false), droppedEvents(0) {}
+};
+
+static double linkTime(const RenderThreadLink& link)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - link.start).count();
+}
+
+// Event thread callbacks of the render thread mode, input is only queued here
+void queueKeyEvent(GLFWwindow* window, int key, int, int action, int)
+{
+	RenderThreadLink* link = (RenderThreadLink*)glfwGetWindowUserPointer(window);
+	InputEvent event = { INPUT_KEY, key, action, 0, 0, linkTime(*link) };
+	if (!link->events.push(event))
+		link->droppedEvents++;
+}
+
+void queueResizeEvent(GLFWwindow* window, int width, int height)
+{
+	RenderThreadLink* link = (RenderThreadLink*)glfwGetWindowUserPointer(window);
+	InputEvent event = { INPUT_RESIZE, 0, 0, width, height, linkTime(*link) };
+	if (!link->events.push(event))
+		link->droppedEvents++;
 }
 
 // Function to process all key inputs
@@ -39,215 +141,764 @@ void processInput(GLFWwindow* window)
 		glfwSetWindowShouldClose(window, true);
 }
 
-int main(int argc, char** argv)
+// Time eager against lazy glad startup, then leave GL loaded in the requested mode
+void benchmarkLoader(GLADloadproc loader, int iterations, bool lazyGL)
 {
-	// Initialize GLFW
-	glfwInit();
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	double eagerTotal = 0.0, eagerBest = 1e30;
+	double lazyTotal = 0.0, lazyBest = 1e30;
 
-	// Create window object
-	GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-	if (window == NULL)
+	for (int i = 0; i < iterations; i++)
 	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
-		return -1;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		gladLoadGLLoader(loader);
+		std::chrono::steady_clock::time_point eagerEnd = std::chrono::steady_clock::now();
+		gladLoadGLLoaderLazy(loader);
+		std::chrono::steady_clock::time_point lazyEnd = std::chrono::steady_clock::now();
+
+		double eagerMs = std::chrono::duration<double, std::milli>(eagerEnd - start).count();
+		double lazyMs = std::chrono::duration<double, std::milli>(lazyEnd - eagerEnd).count();
+		eagerTotal += eagerMs;
+		lazyTotal += lazyMs;
+		if (eagerMs < eagerBest) eagerBest = eagerMs;
+		if (lazyMs < lazyBest) lazyBest = lazyMs;
 	}
-	glfwMakeContextCurrent(window);
 
-	//Initialize GLAD
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	std::cout << "Loader startup over " << iterations << " runs:" << std::endl
+		<< "  eager: mean " << eagerTotal / iterations << " ms, best " << eagerBest << " ms" << std::endl
+		<< "  lazy:  mean " << lazyTotal / iterations << " ms, best " << lazyBest << " ms"
+		<< " (plus one lookup per function on first call)" << std::endl;
+
+	if (lazyGL)
+		gladLoadGLLoaderLazy(loader);
+	else
+		gladLoadGLLoader(loader);
+}
+
+// Result of one headless context rendering on its own thread
+struct ContextRun
+{
+	bool ok;
+	int frames;
+	double seconds;
+};
+
+// Create a headless context with its own dispatch table on the calling thread
+// and render frameCount frames into it
+void runHeadlessContext(int width, int height, int frameCount, ContextRun& run)
+{
+	run.ok = false;
+	run.frames = 0;
+	run.seconds = 0.0;
+
+	HeadlessContext headless;
+	if (!createHeadlessContext(headless, width, height))
+		return;
+
+	GladGLContext* gl = gladCreateGLContext((GLADloadproc)headlessGetProcAddress);
+	if (gl == NULL)
 	{
-		std::cout << "Failed to initialize GLAD" << std::endl;
-		return -1;
+		std::cout << "Failed to load GL for headless context" << std::endl;
+		destroyHeadlessContext(headless);
+		return;
 	}
+	gladMakeGLContextCurrent(gl);
 
-	// Specify the viewport (OpenGL area within the GLFW window)
-	glViewport(0, 0, 800, 600);
-
-	// Specify the resize callback function so viewport adapts on window resize
+	if (createHeadlessTarget(headless))
+	{
+		glViewport(0, 0, width, height);
 
-	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+		Scene scene;
+		createScene(scene);
 
-	// Load and compile the vertex shader
-	unsigned int vertexShader;
-	vertexShader = glCreateShader(GL_VERTEX_SHADER);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frameCount; frame++)
+			drawScene(scene);
+		glFinish();
+		run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		run.frames = frameCount;
+		run.ok = true;
 
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	glCompileShader(vertexShader);
+		destroyScene(scene);
+	}
 
-	// Check for compile errors
-	int success;
-	char infolog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+	destroyHeadlessContext(headless);
+	gladMakeGLContextCurrent(NULL);
+	gladDestroyGLContext(gl);
+}
 
-	if (!success)
+// Drive contextCount independent headless contexts, one per thread
+int runHeadlessContexts(int contextCount, int width, int height, int frameCount)
+{
+	std::vector<ContextRun> runs(contextCount);
+	std::vector<std::thread> threads;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < contextCount; i++)
+		threads.push_back(std::thread(runHeadlessContext, width, height, frameCount, std::ref(runs[i])));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	int totalFrames = 0;
+	for (int i = 0; i < contextCount; i++)
 	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infolog);
-		std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infolog << std::endl;
+		if (!runs[i].ok)
+		{
+			std::cout << "Context " << i << " failed" << std::endl;
+			return -1;
+		}
+		std::cout << "Context " << i << ": " << runs[i].frames / runs[i].seconds << " FPS" << std::endl;
+		totalFrames += runs[i].frames;
 	}
 
-	// Load and compile the fragment shader
-	unsigned int fragmentShader1;
-	fragmentShader1 = glCreateShader(GL_FRAGMENT_SHADER);
+	std::cout << contextCount << " contexts, " << totalFrames << " frames at " << width << "x" << height
+		<< " in " << seconds << " s (" << totalFrames / seconds << " FPS total)" << std::endl;
+	return 0;
+}
 
-	glShaderSource(fragmentShader1, 1, &fragmentShader1Source, NULL);
-	glCompileShader(fragmentShader1);
+int main(int argc, char** argv)
+{
+	// Parse command line options
+	bool headless = false;
+	int width = 800;
+	int height = 600;
+	int frameCount = 1000;
+	bool timing = false;
+	const char* timingCsvPath = NULL;
+	bool lazyGL = false;
+	int benchLoaderIterations = 0;
+	int contextCount = 0;
+	const char* capturePath = NULL;
+	bool batch = false;
+	bool instanced = false;
+	bool indirect = false;
+	bool stateCache = false;
+	bool queued = false;
+	const char* programCachePath = NULL;
+	bool deferredShaders = false;
+	bool spirv = false;
+	bool materials = false;
+	bool renderThread = false;
+	int swapInterval = -1;
+	int framesInFlight = 0;
+	double fpsLimit = 0.0;
+	bool onDemand = false;
+	double resolutionBudget = 0.0;
+	float minScale = 0.5f;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--headless") == 0)
+			headless = true;
+		else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+		{
+			if (sscanf(argv[++i], "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0)
+			{
+				std::cout << "Invalid --size, expected WIDTHxHEIGHT" << std::endl;
+				return -1;
+			}
+		}
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--timing") == 0)
+			timing = true;
+		else if (strcmp(argv[i], "--timing-csv") == 0 && i + 1 < argc)
+		{
+			timing = true;
+			timingCsvPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--lazy-gl") == 0)
+			lazyGL = true;
+		else if (strcmp(argv[i], "--bench-loader") == 0 && i + 1 < argc)
+			benchLoaderIterations = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--contexts") == 0 && i + 1 < argc)
+			contextCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+			capturePath = argv[++i];
+		else if (strcmp(argv[i], "--batch") == 0)
+			batch = true;
+		else if (strcmp(argv[i], "--instanced") == 0)
+			instanced = true;
+		else if (strcmp(argv[i], "--indirect") == 0)
+			indirect = true;
+		else if (strcmp(argv[i], "--state-cache") == 0)
+			stateCache = true;
+		else if (strcmp(argv[i], "--queue") == 0)
+			queued = true;
+		else if (strcmp(argv[i], "--program-cache") == 0 && i + 1 < argc)
+			programCachePath = argv[++i];
+		else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc)
+			swapInterval = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc)
+			framesInFlight = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--fps-limit") == 0 && i + 1 < argc)
+			fpsLimit = atof(argv[++i]);
+		else if (strcmp(argv[i], "--dynamic-resolution") == 0 && i + 1 < argc)
+			resolutionBudget = atof(argv[++i]);
+		else if (strcmp(argv[i], "--min-scale") == 0 && i + 1 < argc)
+			minScale = (float)atof(argv[++i]);
+		else if (strcmp(argv[i], "--on-demand") == 0)
+			onDemand = true;
+		else if (strcmp(argv[i], "--render-thread") == 0)
+			renderThread = true;
+		else if (strcmp(argv[i], "--materials") == 0)
+			materials = true;
+		else if (strcmp(argv[i], "--spirv") == 0)
+			spirv = true;
+		else if (strcmp(argv[i], "--deferred-shaders") == 0)
+			deferredShaders = true;
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--headless] [--size WIDTHxHEIGHT] [--frames N]"
+				<< " [--timing] [--timing-csv FILE] [--lazy-gl] [--bench-loader N]"
+				<< " [--contexts N] [--capture FILE] [--batch] [--instanced] [--indirect]"
+				<< " [--state-cache] [--queue] [--program-cache DIR]"
+				<< " [--deferred-shaders] [--spirv] [--materials] [--render-thread]"
+				<< " [--swap-interval N] [--frames-in-flight N] [--fps-limit HZ] [--on-demand]"
+				<< " [--dynamic-resolution GPU_MS] [--min-scale F]" << std::endl;
+			return -1;
+		}
+	}
 
-	// Check for compile errors
-	glGetShaderiv(fragmentShader1, GL_COMPILE_STATUS, &success);
+	// Each of these picks how the scene's programs are made, only one can
+	if ((deferredShaders ? 1 : 0) + (programCachePath != NULL ? 1 : 0) + (materials ? 1 : 0) + (spirv ? 1 : 0) > 1)
+	{
+		std::cout << "--deferred-shaders, --program-cache, --materials and --spirv can't be combined" << std::endl;
+		return -1;
+	}
 
-	if (!success)
+	// A trace only holds the calls listed in gl_trace.h, so modes that rely
+	// on others would record a trace that doesn't replay what was drawn
+	if (capturePath != NULL)
 	{
-		glGetShaderInfoLog(fragmentShader1, 512, NULL, infolog);
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infolog << std::endl;
+		struct UntracedMode
+		{
+			bool enabled;
+			const char* flag;
+			const char* calls;
+		};
+		const UntracedMode untraced[] = {
+			{ batch, "--batch", "persistent-mapped buffer writes" },
+			{ instanced, "--instanced", "instanced draws, attribute divisors and mapped buffers" },
+			{ indirect, "--indirect", "indirect buffers and multi-draw calls" },
+			{ programCachePath != NULL, "--program-cache", "glProgramBinary" },
+			{ spirv, "--spirv", "glShaderBinary and glSpecializeShader" },
+			{ materials, "--materials", "glBindBufferRange, glUniformBlockBinding and mapped buffers" },
+			{ resolutionBudget > 0.0, "--dynamic-resolution", "textures, framebuffers and uniforms" }
+		};
+		for (size_t i = 0; i < sizeof(untraced) / sizeof(untraced[0]); i++)
+		{
+			if (untraced[i].enabled)
+			{
+				std::cout << "--capture can't be combined with " << untraced[i].flag << ", the trace doesn't record "
+					<< untraced[i].calls << std::endl;
+				return -1;
+			}
+		}
 	}
 
-	// Load and compile the fragment shader
-	unsigned int fragmentShader2;
-	fragmentShader2 = glCreateShader(GL_FRAGMENT_SHADER);
+	if (onDemand && renderThread)
+	{
+		std::cout << "--on-demand and --render-thread can't be combined" << std::endl;
+		return -1;
+	}
 
-	glShaderSource(fragmentShader2, 1, &fragmentShader2Source, NULL);
-	glCompileShader(fragmentShader2);
+	// Several contexts on several threads, each with its own GL dispatch table
+	if (contextCount > 0)
+	{
+		if (!headless)
+		{
+			std::cout << "--contexts needs --headless" << std::endl;
+			return -1;
+		}
+		return runHeadlessContexts(contextCount, width, height, frameCount);
+	}
 
-	// Check for compile errors
-	glGetShaderiv(fragmentShader2, GL_COMPILE_STATUS, &success);
+	GLFWwindow* window = NULL;
+	HeadlessContext headlessContext;
+	GLADloadproc loader;
 
-	if (!success)
+	if (headless)
 	{
-		glGetShaderInfoLog(fragmentShader2, 512, NULL, infolog);
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infolog << std::endl;
+		// Render into an FBO of a surfaceless EGL context, no display needed
+		if (!createHeadlessContext(headlessContext, width, height))
+		{
+			std::cout << "Failed to create headless context" << std::endl;
+			return -1;
+		}
+		loader = (GLADloadproc)headlessGetProcAddress;
+	}
+	else
+	{
+		// Initialize GLFW
+		glfwInit();
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+		// Create window object
+		window = glfwCreateWindow(width, height, "LearnOpenGL", NULL, NULL);
+		if (window == NULL)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			glfwTerminate();
+			return -1;
+		}
+		glfwMakeContextCurrent(window);
+		loader = (GLADloadproc)glfwGetProcAddress;
+
+		// Specify the resize callback function so viewport adapts on window resize
+		glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+		// 0 presents immediately, 1 waits for vblank; the driver decides if not given
+		if (swapInterval >= 0)
+			glfwSwapInterval(swapInterval);
 	}
-	// Combine shaders into shader program
-	unsigned int shaderProgram1;
-	shaderProgram1 = glCreateProgram();
-
-	glAttachShader(shaderProgram1, vertexShader);
-	glAttachShader(shaderProgram1, fragmentShader1);
-	glLinkProgram(shaderProgram1);
 
-	glGetProgramiv(shaderProgram1, GL_LINK_STATUS, &success);
-	if (!success) {
-		glGetProgramInfoLog(shaderProgram1, 512, NULL, infolog);
-		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infolog << std::endl;
+	//Initialize GLAD
+	// (lazy mode only looks up the functions we actually call, on first use)
+	if (!(lazyGL ? gladLoadGLLoaderLazy(loader) : gladLoadGLLoader(loader)))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		if (headless)
+			destroyHeadlessContext(headlessContext);
+		else
+			glfwTerminate();
+		return -1;
 	}
 
-	unsigned int shaderProgram2;
-	shaderProgram2 = glCreateProgram();
+	if (benchLoaderIterations > 0)
+		benchmarkLoader(loader, benchLoaderIterations, lazyGL);
 
-	glAttachShader(shaderProgram2, vertexShader);
-	glAttachShader(shaderProgram2, fragmentShader2);
-	glLinkProgram(shaderProgram2);
+	if (headless)
+	{
+		if (!createHeadlessTarget(headlessContext))
+		{
+			destroyHeadlessContext(headlessContext);
+			return -1;
+		}
 
-	glGetProgramiv(shaderProgram2, GL_LINK_STATUS, &success);
-	if (!success) {
-		glGetProgramInfoLog(shaderProgram2, 512, NULL, infolog);
-		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infolog << std::endl;
+		std::cout << "Headless renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
 	}
 
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader1);
-	glDeleteShader(fragmentShader2);
+	// Specify the viewport (OpenGL area within the window or offscreen target)
+	glViewport(0, 0, width, height);
 
-	// Our rectangle corners
-	/*float vertices[] = {
-		0.5f, 0.5f, 0.0f,
-		0.5f, -0.5f, 0.0f,
-		-0.5f, -0.5f, 0.0f,
-		-0.5f, 0.5f, 0.0f
-	};*/
+	// Record every GL call from here on for replay with glreplay
+	if (capturePath != NULL && !startCapture(capturePath))
+		capturePath = NULL;
+
+	// Drop redundant binds and state changes before they reach the driver
+	// (after the capture hooks, so a trace only holds the calls that got through)
+	if (stateCache)
+		enableStateCache();
+
+	// Shaders, buffers and vertex arrays of the two triangles
+	// (programs come from the binary cache when one is given and still valid)
+	ProgramCache programCache(programCachePath != NULL ? programCachePath : "");
+	std::chrono::steady_clock::time_point sceneStart = std::chrono::steady_clock::now();
+	Scene scene;
+	MaterialSystem materialSystem;
+	bool programsPending = false;
+	if (deferredShaders)
+	{
+		// Rendering starts right away, programs join in as the driver finishes them
+		createSceneDeferred(scene);
+		programsPending = true;
+		std::cout << "Deferred shaders: " << (scene.shaders->parallel() ? "parallel" : "serial")
+			<< " compile, scene setup " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sceneStart).count()
+			<< " ms" << std::endl;
+	}
+	else if (programCachePath != NULL)
+	{
+		programCache.init();
+		createScene(scene, &programCache);
+		double sceneMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sceneStart).count();
+		std::cout << "Scene setup: " << sceneMs << " ms, programs " << programCache.hits() << " from cache, "
+			<< programCache.misses() << " compiled, " << programCache.rejected() << " rejected"
+			<< (programCache.enabled() ? "" : " (no program binary support)") << std::endl;
+	}
+	else if (materials)
+	{
+		// One program, colors in a uniform buffer bound per draw
+		if (!materialSystem.init() || !createSceneMaterials(scene, materialSystem))
+		{
+			std::cout << "Material setup failed, drawing without materials" << std::endl;
+			materialSystem.destroy();
+			materials = false;
+			createScene(scene);
+		}
+	}
+	else if (spirv)
+	{
+		// Precompiled modules where the context takes them, GLSL otherwise
+		if (createSceneSpirv(scene))
+			std::cout << "Scene setup: SPIR-V, " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sceneStart).count()
+				<< " ms" << std::endl;
+		else
+		{
+			std::cout << "SPIR-V shaders not available, compiling GLSL" << std::endl;
+			createScene(scene);
+		}
+	}
+	else
+		createScene(scene);
+
+	// Both triangles in a single streamed draw instead of one per program/VAO
+	Batcher batcher;
+	if (batch && !batcher.init())
+		batch = false;
+
+	// One triangle uploaded once and drawn twice from per-instance attributes
+	InstancedMesh instancedMesh;
+	if (instanced && !createSceneMesh(instancedMesh))
+		instanced = false;
+
+	// Draw commands in a buffer, culled and submitted by the GPU where supported
+	IndirectRenderer indirectRenderer;
+	if (indirect)
+	{
+		indirect = createSceneIndirect(indirectRenderer);
+		if (indirect)
+			std::cout << "Indirect mode: " << IndirectRenderer::modeName(indirectRenderer.mode()) << std::endl;
+	}
 
-	// Vertices for two triangles
-	float vertices1[] = {
-		-0.5f, 0.5f, 0.0f,
-		-0.5f, -0.5f, 0.0f,
-		-0.1f, 0.0f, 0.0f
-	};
-	float vertices2[] = {
-		0.5f, 0.5f, 0.0f,
-		0.5f, -0.5f, 0.0f,
-		0.1f, 0.0f, 0.0f
-	};
+	// Draws sorted by program and VAO before submission
+	RenderQueue renderQueue;
 
-	// Rectangle vertices split into triangles
-	unsigned int indices[] = {
-		0, 1, 3,
-		1, 2, 3
-	};
+	// Everything recorded so far is setup, frames start after this marker
+	if (capturePath != NULL)
+		captureFrameEnd();
 
-	// Bind VAO so we don't have to set up the vertex attributes each time
-	unsigned int VAOs[2];
-	glGenVertexArrays(2, VAOs);
+	// Frame timing (GPU results are read back a few frames late)
+	FrameTimer frameTimer;
+	if (timing)
+	{
+		frameTimer.init();
+		if (timingCsvPath != NULL && !frameTimer.openCsv(timingCsvPath))
+			std::cout << "Failed to open " << timingCsvPath << " for writing" << std::endl;
+	}
 
-	glBindVertexArray(VAOs[0]);
+	// Latency mode: cap the frames queued on the GPU and/or the frame rate
+	bool pacing = framesInFlight > 0 || fpsLimit > 0.0;
+	FramePacer framePacer;
+	if (pacing)
+		framePacer.init(framesInFlight, fpsLimit);
+
+	// Scene drawn into a scaled offscreen target that keeps GPU frames within budget
+	bool dynamicResolution = resolutionBudget > 0.0;
+	DynamicResolution resolution;
+	unsigned int outputFramebuffer = headless ? headlessContext.FBO : 0;
+	if (dynamicResolution && !resolution.init(width, height, resolutionBudget, minScale))
+	{
+		resolution.destroy();
+		dynamicResolution = false;
+	}
 
-	// Create element buffer object to parse indices and vertices into triangles
-	/*
-	unsigned int EBO;
-	glGenBuffers(1, &EBO);
+	// Only draw when something changed; materials feed the time into every frame
+	RedrawState redraw;
+	redraw.animating = materials;
+	WindowState windowState = { onDemand ? &redraw : NULL, dynamicResolution ? &resolution : NULL };
+	if (!headless && !renderThread)
+		glfwSetWindowUserPointer(window, &windowState);
+	if (onDemand && !headless)
+	{
+		glfwSetKeyCallback(window, redrawKeyCallback);
+		glfwSetWindowRefreshCallback(window, redrawRefreshCallback);
+	}
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-	*/
+	// Main rendering loop
+	// (headless mode renders a fixed number of frames and reports throughput)
+	// frame counts the frames actually rendered
+	int frame = 0;
+	StateCacheCounters stateTotals = { 0, 0 };
+	std::chrono::steady_clock::time_point loopStart = std::chrono::steady_clock::now();
+
+	// Swap in deferred programs the driver has finished, true if any were
+	auto updatePrograms = [&]()
+	{
+		if (!programsPending || !updateScenePrograms(scene))
+			return false;
+		programsPending = false;
+		std::cout << "Programs ready after " << frame << " frames, "
+			<< std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sceneStart).count()
+			<< " ms" << std::endl;
+		return true;
+	};
 
-	// Create a vertex buffer object for sending data to GPU memory
-	unsigned int VBOs[2]; // Buffer ID
-	glGenBuffers(2, VBOs);
+	// Everything a frame does between handling input and presenting
+	auto renderFrame = [&]()
+	{
+		if (timing)
+			frameTimer.beginFrame();
+
+		updatePrograms();
 
-	glBindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices1), vertices1, GL_STATIC_DRAW);
+		if (dynamicResolution)
+			resolution.beginFrame(outputFramebuffer);
 
-	// Tell OpenGL how to interpret the vertex array 
-	// (vertex attribute is at location 0, size 3, float type, normalised, stride,
-	// first value at start of buffer)
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
+		// Rendering
+		if (indirect)
+			drawSceneIndirect(indirectRenderer);
+		else if (instanced)
+			drawSceneInstanced(instancedMesh);
+		else if (batch)
+			drawSceneBatched(batcher);
+		else if (materials)
+			drawSceneMaterials(scene, materialSystem, renderQueue,
+				std::chrono::duration<float>(std::chrono::steady_clock::now() - loopStart).count());
+		else if (queued)
+			drawSceneQueued(scene, renderQueue);
+		else
+			drawScene(scene);
+
+		if (dynamicResolution)
+			resolution.endFrame();
+
+		if (timing)
+		{
+			frameTimer.endFrame();
+			if (frame % 500 == 499)
+				frameTimer.printSummary(std::cout);
+		}
+
+		if (stateCache)
+		{
+			StateCacheCounters counters = stateCacheFrameEnd();
+			stateTotals.issued += counters.issued;
+			stateTotals.filtered += counters.filtered;
+		}
+
+		if (capturePath != NULL)
+			captureFrameEnd();
+	};
 
+	if (!renderThread)
+	{
+		// Headless has nothing to wait for, so frames skipped in on-demand
+		// mode still use up --frames
+		while (headless ? frame + redraw.skipped < frameCount : !glfwWindowShouldClose(window))
+		{
+			if (onDemand && !redraw.dirty && !redraw.animating)
+			{
+				// Sleep until an event comes in; the timeout is only there
+				// to notice deferred programs, a data update without events
+				if (!headless)
+					glfwWaitEventsTimeout(programsPending ? 0.05 : 1.0);
+				if (updatePrograms())
+					redraw.dirty = true;
+				if (!redraw.dirty)
+				{
+					redraw.skipped++;
+					continue;
+				}
+			}
+			redraw.dirty = false;
+
+			if (pacing)
+				framePacer.beginFrame();
+
+			// Handle input
+			if (!headless)
+				processInput(window);
+			if (pacing)
+				framePacer.inputSampled();
+
+			renderFrame();
+
+			// Check and call events and swap buffers
+			if (!headless)
+				glfwSwapBuffers(window);
+			if (pacing)
+				framePacer.endFrame();
+			if (!headless)
+				glfwPollEvents();
+			frame++;
+		}
+	}
+	else
+	{
+		// The context moves to a render thread. This thread only handles
+		// window events, passing them on timestamped, so a slow swap no
+		// longer holds up input and slow event handling no longer holds up
+		// frames.
+		RenderThreadLink link;
+		link.start = loopStart;
+		if (headless)
+			releaseHeadlessContext(headlessContext);
+		else
+		{
+			glfwSetWindowUserPointer(window, &link);
+			glfwSetKeyCallback(window, queueKeyEvent);
+			glfwSetFramebufferSizeCallback(window, queueResizeEvent);
+			glfwMakeContextCurrent(NULL);
+		}
+
+		std::thread renderer([&]()
+		{
+			if (headless)
+				makeHeadlessContextCurrent(headlessContext);
+			else
+				glfwMakeContextCurrent(window);
+
+			while (!link.stop.load() && (!headless || frame < frameCount))
+			{
+				if (pacing)
+					framePacer.beginFrame();
+
+				// Input that arrived since the last frame
+				double oldestInput = -1.0;
+				InputEvent event;
+				while (link.events.pop(event))
+				{
+					if (oldestInput < 0.0)
+						oldestInput = event.time;
+					if (event.type == INPUT_KEY && event.key == GLFW_KEY_ESCAPE && event.action == GLFW_PRESS)
+					{
+						glfwSetWindowShouldClose(window, true);
+						glfwPostEmptyEvent();
+					}
+					else if (event.type == INPUT_RESIZE && dynamicResolution)
+						resolution.resize(event.width, event.height);
+					else if (event.type == INPUT_RESIZE)
+						glViewport(0, 0, event.width, event.height);
+				}
+				if (pacing)
+					framePacer.inputSampled();
+
+				renderFrame();
+				if (!headless)
+					glfwSwapBuffers(window);
+				if (pacing)
+					framePacer.endFrame();
+
+				// Dropped if the event thread has fallen behind, it's only statistics
+				FrameReport report;
+				report.frame = frame;
+				report.inputTime = oldestInput;
+				report.presentTime = linkTime(link);
+				link.reports.push(report);
+				frame++;
+			}
+
+			if (headless)
+				releaseHeadlessContext(headlessContext);
+			else
+				glfwMakeContextCurrent(NULL);
+			link.finished.store(true);
+			if (!headless)
+				glfwPostEmptyEvent();
+		});
+
+		// Without a window there are no events, only reports to collect
+		RollingStats inputLatency(4096);
+		RollingStats frameInterval(4096);
+		double lastPresent = -1.0;
+		while (!link.finished.load())
+		{
+			if (headless)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			else
+			{
+				glfwWaitEventsTimeout(0.1);
+				if (glfwWindowShouldClose(window))
+					link.stop.store(true);
+			}
+
+			FrameReport report;
+			while (link.reports.pop(report))
+			{
+				if (report.inputTime >= 0.0)
+					inputLatency.add((report.presentTime - report.inputTime) * 1000.0);
+				if (lastPresent >= 0.0)
+					frameInterval.add((report.presentTime - lastPresent) * 1000.0);
+				lastPresent = report.presentTime;
+			}
+		}
+		renderer.join();
+
+		// Back on this thread for clean-up; its state cache shadow is stale now
+		if (headless)
+			makeHeadlessContextCurrent(headlessContext);
+		else
+			glfwMakeContextCurrent(window);
+		if (stateCache)
+			invalidateStateCache();
+
+		std::cout << "Render thread: frame interval p50 " << frameInterval.percentile(0.5)
+			<< " ms, p99 " << frameInterval.percentile(0.99) << " ms";
+		if (inputLatency.count() > 0)
+			std::cout << ", input to present p50 " << inputLatency.percentile(0.5)
+				<< " ms, max " << inputLatency.percentile(1.0) << " ms";
+		if (link.droppedEvents > 0)
+			std::cout << ", " << link.droppedEvents << " input events dropped";
+		std::cout << std::endl;
+	}
 
-	glBindVertexArray(VAOs[1]);
+	if (stateCache)
+	{
+		disableStateCache();
+		if (frame > 0)
+			std::cout << "State cache: " << (double)stateTotals.issued / frame << " calls issued, "
+				<< (double)stateTotals.filtered / frame << " filtered per frame" << std::endl;
+	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, VBOs[1]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+	if (capturePath != NULL)
+		stopCapture();
 
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
+	if (headless)
+	{
+		// Wait for the last frame to actually finish before stopping the clock
+		glFinish();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count();
+		// Skipped frames take no time, so an on-demand rate would mean nothing
+		if (onDemand)
+			std::cout << frame << " frames rendered, " << redraw.skipped << " skipped at " << width << "x" << height
+				<< " in " << seconds << " s" << std::endl;
+		else
+			std::cout << frame << " frames at " << width << "x" << height << " in " << seconds << " s ("
+				<< frame / seconds << " FPS)" << std::endl;
+	}
 
-	// Background color
-	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+	if (lazyGL)
+		std::cout << "Lazy loader resolved " << gladLazyResolvedCount() << " GL entry points" << std::endl;
 
-	// Wireframe mode
-	//glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+	if (onDemand && !headless)
+		std::cout << "On-demand: " << redraw.skipped << " idle wake-ups without a redraw" << std::endl;
 
-	// Main rendering loop
-	while (!glfwWindowShouldClose(window))
+	if (dynamicResolution)
 	{
-		// Handle input
-		processInput(window);
+		resolution.printSummary(std::cout);
+		resolution.destroy();
+	}
 
-		// Rendering
-		glClear(GL_COLOR_BUFFER_BIT);
-		glUseProgram(shaderProgram1);
-		glBindVertexArray(VAOs[0]);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
-		glUseProgram(shaderProgram2);
-		glBindVertexArray(VAOs[1]);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
-		//glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+	if (pacing)
+	{
+		framePacer.printSummary(std::cout);
+		framePacer.destroy();
+	}
 
-		// Check and call events and swap buffers
-		glfwSwapBuffers(window);
-		glfwPollEvents();
+	if (timing)
+	{
+		frameTimer.finish();
+		frameTimer.printSummary(std::cout);
+		frameTimer.destroy();
 	}
 
 	// Clean-up
-	//glDeleteVertexArrays(1, &VAO);
-	//glDeleteBuffers(1, &VBO);
-	glDeleteProgram(shaderProgram1);
-	glDeleteProgram(shaderProgram2);
-	glfwTerminate();
+	if (batch)
+		batcher.destroy();
+	if (instanced)
+		instancedMesh.destroy();
+	if (indirect)
+		indirectRenderer.destroy();
+	if (materials)
+		materialSystem.destroy();
+	destroyScene(scene);
+	if (headless)
+		destroyHeadlessContext(headlessContext);
+	else
+		glfwTerminate();
 	return 0;
 
 }
@@ -0,0 +1,107 @@
+#include "material_system.h"
+
+#include <cstring>
+#include <iostream>
+#include <glad/glad.h>
+
+// Room for a few frames per region at the largest alignment drivers ask for
+static const size_t FRAME_REGION_SIZE = 16 * 1024;
+
+const char* materialBlocksSource =
+	"layout (std140) uniform Frame\n"
+	"{\n"
+	"	mat4 viewProjection;\n"
+	"	float time;\n"
+	"};\n"
+	"layout (std140) uniform Material\n"
+	"{\n"
+	"	vec4 color;\n"
+	"};\n";
+
+void bindMaterialBlocks(unsigned int program)
+{
+	// Blocks a stage doesn't use may be optimized away
+	unsigned int frame = glGetUniformBlockIndex(program, "Frame");
+	if (frame != GL_INVALID_INDEX)
+		glUniformBlockBinding(program, frame, FRAME_UNIFORM_BINDING);
+	unsigned int material = glGetUniformBlockIndex(program, "Material");
+	if (material != GL_INVALID_INDEX)
+		glUniformBlockBinding(program, material, MATERIAL_UNIFORM_BINDING);
+}
+
+static size_t alignUp(size_t size, size_t alignment)
+{
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+MaterialSystem::MaterialSystem(int maxMaterials)
+	: maxMaterials(maxMaterials), count(0), stride(0), uniformAlignment(0), materialBuffer(0),
+	frameBuffer(GL_UNIFORM_BUFFER, FRAME_REGION_SIZE)
+{
+}
+
+bool MaterialSystem::init()
+{
+	int alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	uniformAlignment = alignment > 0 ? alignment : 256;
+	stride = alignUp(sizeof(MaterialUniforms), uniformAlignment);
+	if (alignUp(sizeof(FrameUniforms), uniformAlignment) > FRAME_REGION_SIZE)
+	{
+		std::cout << "ERROR::MATERIALS::UNIFORM_ALIGNMENT_TOO_LARGE " << alignment << std::endl;
+		return false;
+	}
+
+	glGenBuffers(1, &materialBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, materialBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, stride * maxMaterials, NULL, GL_STATIC_DRAW);
+	count = 0;
+
+	return frameBuffer.init();
+}
+
+void MaterialSystem::destroy()
+{
+	frameBuffer.destroy();
+	glDeleteBuffers(1, &materialBuffer);
+	materialBuffer = 0;
+	count = 0;
+}
+
+int MaterialSystem::addMaterial(const MaterialUniforms& uniforms)
+{
+	if (count >= maxMaterials)
+	{
+		std::cout << "ERROR::MATERIALS::TOO_MANY_MATERIALS " << maxMaterials << std::endl;
+		return -1;
+	}
+	setMaterial(count, uniforms);
+	return count++;
+}
+
+void MaterialSystem::setMaterial(int material, const MaterialUniforms& uniforms)
+{
+	glBindBuffer(GL_UNIFORM_BUFFER, materialBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, stride * material, sizeof(MaterialUniforms), &uniforms);
+}
+
+void MaterialSystem::beginFrame(const FrameUniforms& uniforms)
+{
+	size_t offset;
+	void* destination = frameBuffer.map(sizeof(FrameUniforms), uniformAlignment, offset);
+	if (destination == NULL)
+		return;
+	memcpy(destination, &uniforms, sizeof(FrameUniforms));
+	frameBuffer.unmap();
+	glBindBufferRange(GL_UNIFORM_BUFFER, FRAME_UNIFORM_BINDING, frameBuffer.buffer(), offset, sizeof(FrameUniforms));
+}
+
+void MaterialSystem::bind(int material)
+{
+	glBindBufferRange(GL_UNIFORM_BUFFER, MATERIAL_UNIFORM_BINDING, materialBuffer, stride * material, sizeof(MaterialUniforms));
+}
+
+void MaterialSystem::materialBinder(unsigned int material, void* user)
+{
+	((MaterialSystem*)user)->bind((int)material);
+}
@@ -0,0 +1,74 @@
+#ifndef MATERIAL_SYSTEM_H
+#define MATERIAL_SYSTEM_H
+
+#include <cstddef>
+#include "stream_buffer.h"
+
+// Uniform block binding points used by material shaders
+const unsigned int FRAME_UNIFORM_BINDING = 0;
+const unsigned int MATERIAL_UNIFORM_BINDING = 1;
+
+// std140 contents of the Frame block, written once per frame
+struct FrameUniforms
+{
+	float viewProjection[16];
+	float time;
+	float pad[3];
+};
+
+// std140 contents of the Material block, one per material
+struct MaterialUniforms
+{
+	float color[4];
+};
+
+// GLSL declarations of both blocks, matching the structs above
+extern const char* materialBlocksSource;
+
+// Connect a linked program's Frame and Material blocks to their binding
+// points (GLSL 3.30 has no layout(binding) for blocks)
+void bindMaterialBlocks(unsigned int program);
+
+// Per-material parameters in uniform buffers instead of in shader source.
+//
+// Every material's MaterialUniforms sits in one uniform buffer, each at an
+// offset aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT. Binding a material
+// is one glBindBufferRange onto MATERIAL_UNIFORM_BINDING, so objects that
+// only differ in parameters share a program and only switch the range.
+// bind() fits RenderQueue::setMaterialBinder through materialBinder().
+//
+// FrameUniforms go through a StreamBuffer at FRAME_UNIFORM_BINDING, written
+// once per frame by beginFrame() without waiting on frames in flight.
+class MaterialSystem
+{
+public:
+	MaterialSystem(int maxMaterials = 1024);
+
+	// Needs a current context with GL functions loaded
+	bool init();
+	void destroy();
+
+	// Returns the material id, or -1 when the buffer is full
+	int addMaterial(const MaterialUniforms& uniforms);
+	void setMaterial(int material, const MaterialUniforms& uniforms);
+
+	// Upload and bind this frame's uniforms, once at the start of the frame
+	void beginFrame(const FrameUniforms& uniforms);
+
+	void bind(int material);
+
+	int materialCount() const { return count; }
+
+	// For RenderQueue::setMaterialBinder, with the system as user pointer
+	static void materialBinder(unsigned int material, void* user);
+
+private:
+	int maxMaterials;
+	int count;
+	size_t stride;
+	size_t uniformAlignment;
+	unsigned int materialBuffer;
+	StreamBuffer frameBuffer;
+};
+
+#endif
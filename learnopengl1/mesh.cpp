@@ -0,0 +1,496 @@
+#include "mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <glad/glad.h>
+
+static unsigned int hashVertex(const float* vertex, int stride)
+{
+	// FNV-1a over the raw bytes, so only bit-identical vertices collide on purpose
+	const unsigned char* bytes = (const unsigned char*)vertex;
+	unsigned int hash = 2166136261u;
+	for (size_t i = 0; i < stride * sizeof(float); i++)
+		hash = (hash ^ bytes[i]) * 16777619u;
+	return hash;
+}
+
+IndexedMesh buildIndexedMesh(const float* vertices, size_t vertexCount, int stride)
+{
+	IndexedMesh mesh;
+	mesh.stride = stride;
+	mesh.indices.reserve(vertexCount);
+
+	// Open addressing table of unique vertex numbers, at most half full
+	size_t tableSize = 16;
+	while (tableSize < vertexCount * 2)
+		tableSize *= 2;
+	std::vector<unsigned int> table(tableSize, ~0u);
+
+	for (size_t i = 0; i < vertexCount; i++)
+	{
+		const float* vertex = vertices + i * stride;
+		size_t slot = hashVertex(vertex, stride) & (tableSize - 1);
+
+		while (table[slot] != ~0u &&
+			memcmp(&mesh.vertices[table[slot] * stride], vertex, stride * sizeof(float)) != 0)
+			slot = (slot + 1) & (tableSize - 1);
+
+		if (table[slot] == ~0u)
+		{
+			table[slot] = (unsigned int)mesh.vertexCount();
+			mesh.vertices.insert(mesh.vertices.end(), vertex, vertex + stride);
+		}
+		mesh.indices.push_back(table[slot]);
+	}
+
+	// Drop a trailing partial triangle
+	mesh.indices.resize(mesh.indices.size() - mesh.indices.size() % 3);
+	return mesh;
+}
+
+bool loadObjTriangles(const char* path, std::vector<float>& triangles)
+{
+	FILE* file = fopen(path, "r");
+	if (file == NULL)
+	{
+		std::cout << "ERROR::MESH::OPEN_FAILED " << path << std::endl;
+		return false;
+	}
+
+	std::vector<float> positions;
+	std::vector<long> face;
+	char line[1024];
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		if (line[0] == 'v' && line[1] == ' ')
+		{
+			float x = 0.0f, y = 0.0f, z = 0.0f;
+			sscanf(line + 2, "%f %f %f", &x, &y, &z);
+			positions.push_back(x);
+			positions.push_back(y);
+			positions.push_back(z);
+		}
+		else if (line[0] == 'f' && line[1] == ' ')
+		{
+			// Corners are v, v/vt, v//vn or v/vt/vn; only v matters here
+			face.clear();
+			char* cursor = line + 2;
+			for (;;)
+			{
+				char* end;
+				long index = strtol(cursor, &end, 10);
+				if (end == cursor)
+					break;
+				long vertexCount = (long)positions.size() / 3;
+				face.push_back(index < 0 ? vertexCount + index : index - 1);
+				cursor = end;
+				while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t')
+					cursor++;
+			}
+
+			for (size_t i = 2; i < face.size(); i++)
+			{
+				long corners[3] = { face[0], face[i - 1], face[i] };
+				for (int k = 0; k < 3; k++)
+				{
+					if (corners[k] < 0 || corners[k] * 3 >= (long)positions.size())
+					{
+						std::cout << "ERROR::MESH::BAD_FACE_INDEX " << path << std::endl;
+						fclose(file);
+						return false;
+					}
+					triangles.insert(triangles.end(), positions.begin() + corners[k] * 3, positions.begin() + corners[k] * 3 + 3);
+				}
+			}
+		}
+	}
+
+	fclose(file);
+	return true;
+}
+
+// FIFO post-transform cache: a vertex is cached while fewer than cacheSize
+// misses have happened since it was loaded
+struct CacheSimulator
+{
+	std::vector<unsigned int> loadedAt;
+	unsigned int time;
+	int cacheSize;
+
+	CacheSimulator(size_t vertexCount, int cacheSize)
+		: loadedAt(vertexCount, 0), time(cacheSize + 1), cacheSize(cacheSize)
+	{
+	}
+
+	// Forget everything cached so far
+	void reset() { time += cacheSize + 1; }
+
+	int addTriangle(const unsigned int* triangle)
+	{
+		int misses = 0;
+		for (int k = 0; k < 3; k++)
+		{
+			unsigned int vertex = triangle[k];
+			if (time - loadedAt[vertex] > (unsigned int)cacheSize)
+			{
+				loadedAt[vertex] = time++;
+				misses++;
+			}
+		}
+		return misses;
+	}
+};
+
+double computeACMR(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize)
+{
+	size_t triangleCount = indices.size() / 3;
+	if (triangleCount == 0)
+		return 0.0;
+
+	CacheSimulator cache(vertexCount, cacheSize);
+	size_t misses = 0;
+	for (size_t i = 0; i < triangleCount; i++)
+		misses += cache.addTriangle(&indices[i * 3]);
+	return (double)misses / triangleCount;
+}
+
+// Forsyth's scoring: recently used vertices and vertices with few triangles
+// left score high, so the chosen triangle reuses the cache and finishes off
+// vertices before they are evicted
+static const int forsythCacheSize = 32;
+static const float forsythCacheDecayPower = 1.5f;
+static const float forsythLastTriangleScore = 0.75f;
+static const float forsythValenceBoostScale = 2.0f;
+static const float forsythValenceBoostPower = 0.5f;
+
+static float forsythVertexScore(int cachePosition, unsigned int remainingTriangles)
+{
+	if (remainingTriangles == 0)
+		return -1.0f;
+
+	float score = 0.0f;
+	if (cachePosition >= 0)
+	{
+		// The last triangle's vertices get a fixed score, so the next one
+		// doesn't just walk straight back over the same edge
+		if (cachePosition < 3)
+			score = forsythLastTriangleScore;
+		else
+			score = powf(1.0f - (float)(cachePosition - 3) / (forsythCacheSize - 3), forsythCacheDecayPower);
+	}
+	return score + forsythValenceBoostScale * powf((float)remainingTriangles, -forsythValenceBoostPower);
+}
+
+void optimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount)
+{
+	size_t triangleCount = indices.size() / 3;
+	if (triangleCount == 0)
+		return;
+
+	// Triangles of each vertex, the live ones kept at the front of its range
+	std::vector<unsigned int> liveCount(vertexCount, 0);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+		liveCount[indices[i]]++;
+
+	std::vector<unsigned int> firstTriangle(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+		firstTriangle[v + 1] = firstTriangle[v] + liveCount[v];
+
+	std::vector<unsigned int> vertexTriangles(triangleCount * 3);
+	std::vector<unsigned int> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+	for (size_t t = 0; t < triangleCount; t++)
+		for (int k = 0; k < 3; k++)
+			vertexTriangles[filled[indices[t * 3 + k]]++] = (unsigned int)t;
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> vertexScore(vertexCount);
+	for (size_t v = 0; v < vertexCount; v++)
+		vertexScore[v] = forsythVertexScore(-1, liveCount[v]);
+
+	std::vector<float> triangleScore(triangleCount);
+	for (size_t t = 0; t < triangleCount; t++)
+		triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+	std::vector<char> emitted(triangleCount, 0);
+	std::vector<unsigned int> result;
+	result.reserve(triangleCount * 3);
+
+	// Room for the full cache plus the three vertices pushed in front of it
+	unsigned int cache[forsythCacheSize + 3];
+	unsigned int newCache[forsythCacheSize + 3];
+	int cacheCount = 0;
+
+	size_t scanCursor = 0;
+	long long best = std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin();
+
+	while (result.size() < triangleCount * 3)
+	{
+		// Nothing in the cache is connected to anything left, start elsewhere
+		if (best < 0)
+		{
+			while (emitted[scanCursor])
+				scanCursor++;
+			best = (long long)scanCursor;
+		}
+
+		const unsigned int* triangle = &indices[best * 3];
+		result.insert(result.end(), triangle, triangle + 3);
+		emitted[best] = 1;
+
+		// Take the triangle off its vertices' live lists
+		for (int k = 0; k < 3; k++)
+		{
+			unsigned int vertex = triangle[k];
+			unsigned int* begin = &vertexTriangles[firstTriangle[vertex]];
+			unsigned int* end = begin + liveCount[vertex];
+			unsigned int* found = std::find(begin, end, (unsigned int)best);
+			std::swap(*found, *(end - 1));
+			liveCount[vertex]--;
+		}
+
+		// Its vertices move to the front of the cache, the rest shift back
+		int newCount = 0;
+		for (int k = 0; k < 3; k++)
+			newCache[newCount++] = triangle[k];
+		for (int i = 0; i < cacheCount; i++)
+		{
+			unsigned int vertex = cache[i];
+			if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+				newCache[newCount++] = vertex;
+		}
+
+		// Rescore everything whose cache position changed and pick the best
+		// live triangle touching the cache
+		float bestScore = -1.0f;
+		best = -1;
+		for (int i = 0; i < newCount; i++)
+		{
+			unsigned int vertex = newCache[i];
+			cachePosition[vertex] = i < forsythCacheSize ? i : -1;
+
+			float score = forsythVertexScore(cachePosition[vertex], liveCount[vertex]);
+			float delta = score - vertexScore[vertex];
+			vertexScore[vertex] = score;
+
+			const unsigned int* live = &vertexTriangles[firstTriangle[vertex]];
+			for (unsigned int j = 0; j < liveCount[vertex]; j++)
+			{
+				unsigned int t = live[j];
+				triangleScore[t] += delta;
+				if (triangleScore[t] > bestScore)
+				{
+					bestScore = triangleScore[t];
+					best = t;
+				}
+			}
+		}
+
+		cacheCount = newCount < forsythCacheSize ? newCount : forsythCacheSize;
+		memcpy(cache, newCache, cacheCount * sizeof(unsigned int));
+	}
+
+	indices.swap(result);
+}
+
+struct TriangleCluster
+{
+	size_t first;
+	size_t count;
+	float sortKey;
+};
+
+void optimizeOverdraw(IndexedMesh& mesh, float threshold)
+{
+	size_t triangleCount = mesh.triangleCount();
+	size_t vertexCount = mesh.vertexCount();
+	if (triangleCount == 0)
+		return;
+
+	const int cacheSize = 16;
+	const std::vector<unsigned int>& indices = mesh.indices;
+
+	// Hard boundaries: triangles that miss on all three vertices start a new
+	// strip-like run, so cutting there costs no cache efficiency at all
+	std::vector<size_t> hardBoundaries;
+	{
+		CacheSimulator cache(vertexCount, cacheSize);
+		for (size_t t = 0; t < triangleCount; t++)
+			if (cache.addTriangle(&indices[t * 3]) == 3 || t == 0)
+				hardBoundaries.push_back(t);
+	}
+	hardBoundaries.push_back(triangleCount);
+
+	// Soft boundaries: split runs further wherever the part so far is no
+	// worse than threshold times the run's own ACMR
+	std::vector<TriangleCluster> clusters;
+	CacheSimulator cache(vertexCount, cacheSize);
+	for (size_t h = 0; h + 1 < hardBoundaries.size(); h++)
+	{
+		size_t start = hardBoundaries[h];
+		size_t end = hardBoundaries[h + 1];
+
+		cache.reset();
+		size_t runMisses = 0;
+		for (size_t t = start; t < end; t++)
+			runMisses += cache.addTriangle(&indices[t * 3]);
+		double clusterThreshold = threshold * (double)runMisses / (end - start);
+
+		cache.reset();
+		size_t clusterStart = start;
+		size_t misses = 0;
+		for (size_t t = start; t < end; t++)
+		{
+			misses += cache.addTriangle(&indices[t * 3]);
+			size_t clusterSize = t + 1 - clusterStart;
+			if (t + 1 < end && (double)misses / clusterSize <= clusterThreshold)
+			{
+				TriangleCluster cluster = { clusterStart, clusterSize, 0.0f };
+				clusters.push_back(cluster);
+				clusterStart = t + 1;
+				misses = 0;
+				cache.reset();
+			}
+		}
+		TriangleCluster cluster = { clusterStart, end - clusterStart, 0.0f };
+		clusters.push_back(cluster);
+	}
+
+	// Area weighted centroid of the whole mesh and of each cluster, plus
+	// each cluster's average normal. Clusters facing away from the centre
+	// are on the outside and get drawn first.
+	const float* v = mesh.vertices.data();
+	int stride = mesh.stride;
+	float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+	float meshArea = 0.0f;
+	std::vector<float> clusterData(clusters.size() * 7, 0.0f);
+
+	for (size_t c = 0; c < clusters.size(); c++)
+	{
+		float* data = &clusterData[c * 7];
+		for (size_t t = clusters[c].first; t < clusters[c].first + clusters[c].count; t++)
+		{
+			const float* a = v + indices[t * 3] * stride;
+			const float* b = v + indices[t * 3 + 1] * stride;
+			const float* d = v + indices[t * 3 + 2] * stride;
+			float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			float e2[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+			float normal[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			float area = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+			for (int k = 0; k < 3; k++)
+			{
+				float center = (a[k] + b[k] + d[k]) / 3.0f;
+				data[k] += center * area;
+				data[3 + k] += normal[k];
+				meshCentroid[k] += center * area;
+			}
+			data[6] += area;
+			meshArea += area;
+		}
+	}
+	if (meshArea > 0.0f)
+		for (int k = 0; k < 3; k++)
+			meshCentroid[k] /= meshArea;
+
+	for (size_t c = 0; c < clusters.size(); c++)
+	{
+		const float* data = &clusterData[c * 7];
+		float normalLength = sqrtf(data[3] * data[3] + data[4] * data[4] + data[5] * data[5]);
+		if (data[6] <= 0.0f || normalLength <= 0.0f)
+			continue;
+
+		float key = 0.0f;
+		for (int k = 0; k < 3; k++)
+			key += (data[k] / data[6] - meshCentroid[k]) * (data[3 + k] / normalLength);
+		clusters[c].sortKey = key;
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(),
+		[](const TriangleCluster& a, const TriangleCluster& b) { return a.sortKey > b.sortKey; });
+
+	std::vector<unsigned int> result;
+	result.reserve(indices.size());
+	for (size_t c = 0; c < clusters.size(); c++)
+		result.insert(result.end(), indices.begin() + clusters[c].first * 3,
+			indices.begin() + (clusters[c].first + clusters[c].count) * 3);
+	mesh.indices.swap(result);
+}
+
+void optimizeVertexFetch(IndexedMesh& mesh)
+{
+	size_t vertexCount = mesh.vertexCount();
+	std::vector<unsigned int> remap(vertexCount, ~0u);
+	std::vector<float> vertices;
+	vertices.reserve(mesh.vertices.size());
+
+	// Vertices no triangle uses are dropped on the way
+	for (size_t i = 0; i < mesh.indices.size(); i++)
+	{
+		unsigned int& index = mesh.indices[i];
+		if (remap[index] == ~0u)
+		{
+			remap[index] = (unsigned int)(vertices.size() / mesh.stride);
+			vertices.insert(vertices.end(), mesh.vertices.begin() + index * mesh.stride,
+				mesh.vertices.begin() + (index + 1) * mesh.stride);
+		}
+		index = remap[index];
+	}
+	mesh.vertices.swap(vertices);
+}
+
+void optimizeMesh(IndexedMesh& mesh)
+{
+	optimizeVertexCache(mesh.indices, mesh.vertexCount());
+	optimizeOverdraw(mesh);
+	optimizeVertexFetch(mesh);
+}
+
+bool uploadMesh(const IndexedMesh& mesh, GpuMesh& gpuMesh)
+{
+	gpuMesh.indexCount = (int)mesh.indices.size();
+	gpuMesh.indexType = mesh.vertexCount() <= 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+	glGenVertexArrays(1, &gpuMesh.VAO);
+	glBindVertexArray(gpuMesh.VAO);
+
+	glGenBuffers(1, &gpuMesh.VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, gpuMesh.VBO);
+	glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(float), mesh.vertices.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, mesh.stride * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	// Half the index memory and bandwidth when every index fits in 16 bits
+	glGenBuffers(1, &gpuMesh.EBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuMesh.EBO);
+	if (gpuMesh.indexType == GL_UNSIGNED_SHORT)
+	{
+		std::vector<unsigned short> shortIndices(mesh.indices.begin(), mesh.indices.end());
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, shortIndices.size() * sizeof(unsigned short), shortIndices.data(), GL_STATIC_DRAW);
+	}
+	else
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(unsigned int), mesh.indices.data(), GL_STATIC_DRAW);
+
+	glBindVertexArray(0);
+	return gpuMesh.indexCount > 0;
+}
+
+void drawMesh(const GpuMesh& gpuMesh)
+{
+	glBindVertexArray(gpuMesh.VAO);
+	glDrawElements(GL_TRIANGLES, gpuMesh.indexCount, gpuMesh.indexType, 0);
+}
+
+void destroyMesh(GpuMesh& gpuMesh)
+{
+	glDeleteVertexArrays(1, &gpuMesh.VAO);
+	glDeleteBuffers(1, &gpuMesh.VBO);
+	glDeleteBuffers(1, &gpuMesh.EBO);
+	gpuMesh.VAO = 0;
+	gpuMesh.VBO = 0;
+	gpuMesh.EBO = 0;
+	gpuMesh.indexCount = 0;
+}
@@ -0,0 +1,64 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <cstddef>
+#include <vector>
+
+// Indexed triangle mesh. Each vertex is `stride` floats and starts with its
+// x, y, z position; any further floats are carried along untouched.
+struct IndexedMesh
+{
+	std::vector<float> vertices;
+	std::vector<unsigned int> indices;
+	int stride;
+
+	size_t vertexCount() const { return stride > 0 ? vertices.size() / stride : 0; }
+	size_t triangleCount() const { return indices.size() / 3; }
+};
+
+// Build an indexed mesh from a triangle list (every 3 vertices one triangle),
+// merging vertices whose floats are bit-identical
+IndexedMesh buildIndexedMesh(const float* vertices, size_t vertexCount, int stride);
+
+// Read the faces of a Wavefront OBJ file as a triangle list of positions
+// (polygons are fanned), ready for buildIndexedMesh with a stride of 3
+bool loadObjTriangles(const char* path, std::vector<float>& triangles);
+
+// Average cache miss ratio: vertices shaded per triangle with a FIFO
+// post-transform cache of cacheSize entries. 3.0 means nothing is reused,
+// a well ordered regular grid gets close to 0.5-0.7.
+double computeACMR(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize = 16);
+
+// Reorder triangles for post-transform cache locality (Forsyth's linear-speed
+// vertex cache optimisation)
+void optimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount);
+
+// Reorder clusters of triangles so that ones facing outwards are drawn
+// first, cutting overdraw, while keeping the ACMR within threshold times
+// its value after optimizeVertexCache (Tipsify-style clustering)
+void optimizeOverdraw(IndexedMesh& mesh, float threshold = 1.05f);
+
+// Renumber vertices in the order they are first used, so vertex fetch walks
+// memory forwards. Run after the triangle order is final.
+void optimizeVertexFetch(IndexedMesh& mesh);
+
+// Cache and overdraw passes, then fetch reordering (buildIndexedMesh
+// already did the dedup)
+void optimizeMesh(IndexedMesh& mesh);
+
+// The mesh uploaded for drawing: positions at attribute 0, 16-bit indices
+// whenever the vertex count allows it
+struct GpuMesh
+{
+	unsigned int VAO;
+	unsigned int VBO;
+	unsigned int EBO;
+	int indexCount;
+	unsigned int indexType;
+};
+
+bool uploadMesh(const IndexedMesh& mesh, GpuMesh& gpuMesh);
+void drawMesh(const GpuMesh& gpuMesh);
+void destroyMesh(GpuMesh& gpuMesh);
+
+#endif
@@ -0,0 +1,215 @@
+#include "program_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <glad/glad.h>
+#include "glad_ext.h"
+#include "shader.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#define makeDirectory(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define makeDirectory(path) mkdir(path, 0755)
+#endif
+
+// File layout (native byte order): "GLPB", uint32 version, uint64 key,
+// uint32 binary format, uint32 binary length, then the binary
+static const char CACHE_MAGIC[4] = { 'G', 'L', 'P', 'B' };
+static const unsigned int CACHE_VERSION = 1;
+
+struct CacheHeader
+{
+	char magic[4];
+	unsigned int version;
+	unsigned long long key;
+	unsigned int format;
+	unsigned int length;
+};
+
+// FNV-1a, continued across the parts of the key; the terminating zero is
+// hashed too so "ab"+"c" and "a"+"bc" differ
+static unsigned long long hashString(unsigned long long hash, const char* text)
+{
+	if (text == NULL)
+		text = "";
+	do
+	{
+		hash ^= (unsigned char)*text;
+		hash *= 1099511628211ULL;
+	} while (*text++ != 0);
+	return hash;
+}
+
+static std::string withDefines(const char* source, const char* defines)
+{
+	std::string text(source);
+	if (defines == NULL || defines[0] == 0)
+		return text;
+
+	// #version has to stay the first line
+	size_t insertAt = 0;
+	if (text.compare(0, 8, "#version") == 0)
+	{
+		size_t lineEnd = text.find('\n');
+		insertAt = lineEnd == std::string::npos ? text.size() : lineEnd + 1;
+	}
+	std::string block(defines);
+	if (!block.empty() && block[block.size() - 1] != '\n')
+		block += '\n';
+	text.insert(insertAt, block);
+	return text;
+}
+
+ProgramCache::ProgramCache(const char* directory)
+	: directory(directory), supported(false), hitCount(0), missCount(0), rejectCount(0)
+{
+}
+
+void ProgramCache::init()
+{
+	supported = false;
+
+	// glad only loads these for GL 4.1, but the extension's entry points
+	// have the same names, so fill them in on older contexts that have it
+	if (gladGLProc("glGetProgramBinary") == NULL && gladHasExtension("GL_ARB_get_program_binary"))
+	{
+		gladSetGLProc("glGetProgramBinary", gladGetExtensionProc("glGetProgramBinary"));
+		gladSetGLProc("glProgramBinary", gladGetExtensionProc("glProgramBinary"));
+		gladSetGLProc("glProgramParameteri", gladGetExtensionProc("glProgramParameteri"));
+	}
+
+	if (gladGLProc("glGetProgramBinary") == NULL || gladGLProc("glProgramBinary") == NULL
+		|| gladGLProc("glProgramParameteri") == NULL)
+		return;
+
+	int formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (formats <= 0)
+		return;
+
+	driver = std::string((const char*)glGetString(GL_VENDOR)) + "\n"
+		+ (const char*)glGetString(GL_RENDERER) + "\n"
+		+ (const char*)glGetString(GL_VERSION);
+	supported = true;
+}
+
+unsigned int ProgramCache::getProgram(const char* vertexSource, const char* fragmentSource, const char* defines)
+{
+	std::string vertexText = withDefines(vertexSource, defines);
+	std::string fragmentText = withDefines(fragmentSource, defines);
+
+	if (!supported)
+	{
+		missCount++;
+		return createProgram(vertexText.c_str(), fragmentText.c_str());
+	}
+
+	unsigned long long key = 14695981039346656037ULL;
+	key = hashString(key, driver.c_str());
+	key = hashString(key, defines);
+	key = hashString(key, vertexSource);
+	key = hashString(key, fragmentSource);
+
+	char name[32];
+	snprintf(name, sizeof(name), "/%016llx.bin", key);
+	std::string path = directory + name;
+
+	unsigned int program = load(path, key);
+	if (program != 0)
+	{
+		hitCount++;
+		return program;
+	}
+
+	missCount++;
+	program = createProgram(vertexText.c_str(), fragmentText.c_str(), true);
+	if (program != 0)
+		store(path, key, program);
+	return program;
+}
+
+unsigned int ProgramCache::load(const std::string& path, unsigned long long key)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+		return 0;
+
+	CacheHeader header;
+	std::vector<unsigned char> binary;
+	bool ok = fread(&header, sizeof(header), 1, file) == 1
+		&& memcmp(header.magic, CACHE_MAGIC, 4) == 0
+		&& header.version == CACHE_VERSION
+		&& header.key == key
+		&& header.length > 0;
+	if (ok)
+	{
+		binary.resize(header.length);
+		ok = fread(binary.data(), 1, binary.size(), file) == binary.size();
+	}
+	fclose(file);
+	if (!ok)
+	{
+		std::cout << "ERROR::PROGRAM_CACHE::CORRUPT_ENTRY " << path << std::endl;
+		rejectCount++;
+		return 0;
+	}
+
+	unsigned int program = glCreateProgram();
+	glProgramBinary(program, header.format, binary.data(), (int)binary.size());
+
+	// Drivers reject binaries from other builds through the link status
+	int success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glDeleteProgram(program);
+		rejectCount++;
+		return 0;
+	}
+	return program;
+}
+
+void ProgramCache::store(const std::string& path, unsigned long long key, unsigned int program)
+{
+	int length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	CacheHeader header;
+	memcpy(header.magic, CACHE_MAGIC, 4);
+	header.version = CACHE_VERSION;
+	header.key = key;
+	header.format = 0;
+	std::vector<unsigned char> binary(length);
+	int written = 0;
+	glGetProgramBinary(program, length, &written, &header.format, binary.data());
+	if (written <= 0)
+		return;
+	header.length = (unsigned int)written;
+
+	makeDirectory(directory.c_str());
+
+	// Write next to the entry and rename, so a crash never leaves half a file
+	std::string temporary = path + ".tmp";
+	FILE* file = fopen(temporary.c_str(), "wb");
+	if (file == NULL)
+	{
+		std::cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << path << std::endl;
+		return;
+	}
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+		&& fwrite(binary.data(), 1, written, file) == (size_t)written;
+	ok = fclose(file) == 0 && ok;
+
+	remove(path.c_str());
+	if (!ok || rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		remove(temporary.c_str());
+		std::cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << path << std::endl;
+	}
+}
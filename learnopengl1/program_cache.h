@@ -0,0 +1,50 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <string>
+
+// On-disk cache of linked program binaries.
+//
+// Programs are keyed by a 64-bit hash of the GL vendor, renderer and version
+// strings, the defines and both shader sources, and stored one file per key
+// as the output of glGetProgramBinary. A later run with the same driver and
+// sources restores the program with glProgramBinary instead of compiling
+// and linking. If the file is missing, damaged or the driver rejects the
+// binary (a driver update can do that without changing the version string),
+// the program is compiled as usual and the file rewritten.
+//
+// Without GL 4.1 / ARB_get_program_binary, or when the driver offers no
+// binary formats, every request simply compiles.
+class ProgramCache
+{
+public:
+	// directory is created on first store if it does not exist
+	ProgramCache(const char* directory);
+
+	// Needs a current context with GL functions loaded
+	void init();
+
+	// defines (may be NULL) are "#define NAME VALUE\n" lines inserted after
+	// each source's #version line. Returns 0 if compiling failed.
+	unsigned int getProgram(const char* vertexSource, const char* fragmentSource, const char* defines = NULL);
+
+	bool enabled() const { return supported; }
+
+	// Programs restored from disk, compiled, and restored but rejected
+	int hits() const { return hitCount; }
+	int misses() const { return missCount; }
+	int rejected() const { return rejectCount; }
+
+private:
+	unsigned int load(const std::string& path, unsigned long long key);
+	void store(const std::string& path, unsigned long long key, unsigned int program);
+
+	std::string directory;
+	std::string driver;
+	bool supported;
+	int hitCount;
+	int missCount;
+	int rejectCount;
+};
+
+#endif
@@ -0,0 +1,414 @@
+#include "program_reflection.h"
+
+#include <cstring>
+#include <iostream>
+#include <glad/glad.h>
+
+// Words of one element of a uniform of this type (scalars and samplers are 1)
+static int typeWords(unsigned int type)
+{
+	switch (type)
+	{
+	case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2:
+		return 2;
+	case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:
+		return 3;
+	case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: case GL_FLOAT_MAT2:
+		return 4;
+	case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2:
+		return 6;
+	case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2:
+		return 8;
+	case GL_FLOAT_MAT3:
+		return 9;
+	case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3:
+		return 12;
+	case GL_FLOAT_MAT4:
+		return 16;
+	default:
+		return 1;
+	}
+}
+
+// "lights[0]" is how drivers report the array "lights"
+static std::string baseName(const char* name)
+{
+	std::string base(name);
+	if (base.size() > 3 && base.compare(base.size() - 3, 3, "[0]") == 0)
+		base.resize(base.size() - 3);
+	return base;
+}
+
+int ProgramReflection::NameTable::build(const std::vector<unsigned int>& names)
+{
+	size_t size = 1;
+	while (size < names.size() * 2)
+		size *= 2;
+	hashes.assign(size, 0);
+	entries.assign(size, -1);
+
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		size_t slot = names[i] & (size - 1);
+		while (entries[slot] != -1)
+		{
+			if (hashes[slot] == names[i])
+				return (int)i;
+			slot = (slot + 1) & (size - 1);
+		}
+		hashes[slot] = names[i];
+		entries[slot] = (int)i;
+	}
+	return -1;
+}
+
+int ProgramReflection::NameTable::find(unsigned int hash) const
+{
+	size_t mask = entries.size() - 1;
+	for (size_t slot = hash & mask; entries[slot] != -1; slot = (slot + 1) & mask)
+	{
+		if (hashes[slot] == hash)
+			return entries[slot];
+	}
+	return -1;
+}
+
+ProgramReflection::ProgramReflection()
+	: program(0), uploadCount(0), skipCount(0)
+{
+	std::vector<unsigned int> none;
+	uniformTable.build(none);
+	attributeTable.build(none);
+	blockTable.build(none);
+}
+
+bool ProgramReflection::reflect(unsigned int name)
+{
+	program = name;
+	uniformList.clear();
+	attributeList.clear();
+	blockList.clear();
+	uploadCount = 0;
+	skipCount = 0;
+
+	int linked = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		std::cout << "ERROR::SHADER::REFLECTION::PROGRAM_NOT_LINKED" << std::endl;
+		buildTables();
+		return false;
+	}
+
+	if (GLAD_GL_VERSION_4_3)
+		reflectInterfaces();
+	else
+		reflectClassic();
+
+	if (!buildTables())
+	{
+		uniformList.clear();
+		attributeList.clear();
+		blockList.clear();
+		buildTables();
+		return false;
+	}
+	return true;
+}
+
+void ProgramReflection::reflectInterfaces()
+{
+	std::vector<char> name;
+	int count = 0;
+
+	// Uniforms in blocks have no location and are left to the block
+	glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+	const GLenum uniformProperties[] = { GL_NAME_LENGTH, GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION, GL_BLOCK_INDEX };
+	for (int i = 0; i < count; i++)
+	{
+		int values[5];
+		glGetProgramResourceiv(program, GL_UNIFORM, i, 5, uniformProperties, 5, NULL, values);
+		if (values[4] != -1 || values[3] < 0)
+			continue;
+		name.resize(values[0] + 1);
+		glGetProgramResourceName(program, GL_UNIFORM, i, (GLsizei)name.size(), NULL, &name[0]);
+
+		Uniform uniform;
+		uniform.name = baseName(&name[0]);
+		uniform.type = values[1];
+		uniform.arraySize = values[2];
+		uniform.location = values[3];
+		uniformList.push_back(uniform);
+	}
+
+	// Built-in inputs (gl_VertexID and such) have no location either
+	glGetProgramInterfaceiv(program, GL_PROGRAM_INPUT, GL_ACTIVE_RESOURCES, &count);
+	const GLenum inputProperties[] = { GL_NAME_LENGTH, GL_TYPE, GL_LOCATION };
+	for (int i = 0; i < count; i++)
+	{
+		int values[3];
+		glGetProgramResourceiv(program, GL_PROGRAM_INPUT, i, 3, inputProperties, 3, NULL, values);
+		if (values[2] < 0)
+			continue;
+		name.resize(values[0] + 1);
+		glGetProgramResourceName(program, GL_PROGRAM_INPUT, i, (GLsizei)name.size(), NULL, &name[0]);
+
+		Attribute attribute;
+		attribute.name = baseName(&name[0]);
+		attribute.type = values[1];
+		attribute.location = values[2];
+		attributeList.push_back(attribute);
+	}
+
+	glGetProgramInterfaceiv(program, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &count);
+	const GLenum blockProperties[] = { GL_NAME_LENGTH, GL_BUFFER_DATA_SIZE };
+	for (int i = 0; i < count; i++)
+	{
+		int values[2];
+		glGetProgramResourceiv(program, GL_UNIFORM_BLOCK, i, 2, blockProperties, 2, NULL, values);
+		name.resize(values[0] + 1);
+		glGetProgramResourceName(program, GL_UNIFORM_BLOCK, i, (GLsizei)name.size(), NULL, &name[0]);
+
+		Block block;
+		block.name = baseName(&name[0]);
+		block.index = i;
+		block.size = values[1];
+		blockList.push_back(block);
+	}
+}
+
+void ProgramReflection::reflectClassic()
+{
+	std::vector<char> name;
+	int count = 0;
+	int maxLength = 0;
+
+	glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+	name.resize(maxLength + 1);
+	for (int i = 0; i < count; i++)
+	{
+		int size;
+		unsigned int type;
+		glGetActiveUniform(program, i, (GLsizei)name.size(), NULL, &size, &type, &name[0]);
+		int location = glGetUniformLocation(program, &name[0]);
+		if (location < 0)
+			continue;
+
+		Uniform uniform;
+		uniform.name = baseName(&name[0]);
+		uniform.type = type;
+		uniform.arraySize = size;
+		uniform.location = location;
+		uniformList.push_back(uniform);
+	}
+
+	glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+	glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+	name.resize(maxLength + 1);
+	for (int i = 0; i < count; i++)
+	{
+		int size;
+		unsigned int type;
+		glGetActiveAttrib(program, i, (GLsizei)name.size(), NULL, &size, &type, &name[0]);
+		int location = glGetAttribLocation(program, &name[0]);
+		if (location < 0)
+			continue;
+
+		Attribute attribute;
+		attribute.name = baseName(&name[0]);
+		attribute.type = type;
+		attribute.location = location;
+		attributeList.push_back(attribute);
+	}
+
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+	name.resize(maxLength + 1);
+	for (int i = 0; i < count; i++)
+	{
+		glGetActiveUniformBlockName(program, i, (GLsizei)name.size(), NULL, &name[0]);
+
+		Block block;
+		block.name = baseName(&name[0]);
+		block.index = i;
+		glGetActiveUniformBlockiv(program, i, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size);
+		blockList.push_back(block);
+	}
+}
+
+bool ProgramReflection::buildTables()
+{
+	// Value cache: room for one element, the setters don't reach the others
+	int words = 0;
+	std::vector<unsigned int> names;
+	for (size_t i = 0; i < uniformList.size(); i++)
+	{
+		Uniform& uniform = uniformList[i];
+		uniform.hash = shaderName(uniform.name.c_str());
+		uniform.valueOffset = words;
+		uniform.valueWords = typeWords(uniform.type);
+		uniform.valueKnown = false;
+		words += uniform.valueWords;
+		names.push_back(uniform.hash);
+	}
+	values.assign(words, 0);
+
+	int collision = uniformTable.build(names);
+	if (collision >= 0)
+	{
+		std::cout << "ERROR::SHADER::REFLECTION::NAME_HASH_COLLISION " << uniformList[collision].name << std::endl;
+		return false;
+	}
+
+	names.clear();
+	for (size_t i = 0; i < attributeList.size(); i++)
+	{
+		attributeList[i].hash = shaderName(attributeList[i].name.c_str());
+		names.push_back(attributeList[i].hash);
+	}
+	collision = attributeTable.build(names);
+	if (collision >= 0)
+	{
+		std::cout << "ERROR::SHADER::REFLECTION::NAME_HASH_COLLISION " << attributeList[collision].name << std::endl;
+		return false;
+	}
+
+	names.clear();
+	for (size_t i = 0; i < blockList.size(); i++)
+	{
+		blockList[i].hash = shaderName(blockList[i].name.c_str());
+		names.push_back(blockList[i].hash);
+	}
+	collision = blockTable.build(names);
+	if (collision >= 0)
+	{
+		std::cout << "ERROR::SHADER::REFLECTION::NAME_HASH_COLLISION " << blockList[collision].name << std::endl;
+		return false;
+	}
+	return true;
+}
+
+const ProgramReflection::Uniform* ProgramReflection::uniform(unsigned int name) const
+{
+	int index = uniformTable.find(name);
+	return index < 0 ? NULL : &uniformList[index];
+}
+
+int ProgramReflection::uniformLocation(unsigned int name) const
+{
+	int index = uniformTable.find(name);
+	return index < 0 ? -1 : uniformList[index].location;
+}
+
+int ProgramReflection::attributeLocation(unsigned int name) const
+{
+	int index = attributeTable.find(name);
+	return index < 0 ? -1 : attributeList[index].location;
+}
+
+int ProgramReflection::blockIndex(unsigned int name) const
+{
+	int index = blockTable.find(name);
+	return index < 0 ? -1 : (int)blockList[index].index;
+}
+
+bool ProgramReflection::bindBlock(unsigned int name, unsigned int binding)
+{
+	int index = blockIndex(name);
+	if (index < 0)
+		return false;
+	glUniformBlockBinding(program, index, binding);
+	return true;
+}
+
+ProgramReflection::Uniform* ProgramReflection::changed(unsigned int name, const void* value, int words, bool& found)
+{
+	int index = uniformTable.find(name);
+	// A setter of the wrong size would only raise a GL error; only the first
+	// element of an array is set through these
+	found = index >= 0 && words == uniformList[index].valueWords;
+	if (!found)
+		return NULL;
+
+	Uniform& uniform = uniformList[index];
+	unsigned int* last = &values[uniform.valueOffset];
+	if (uniform.valueKnown && memcmp(last, value, words * sizeof(unsigned int)) == 0)
+	{
+		skipCount++;
+		return NULL;
+	}
+	memcpy(last, value, words * sizeof(unsigned int));
+	uniform.valueKnown = true;
+	uploadCount++;
+	return &uniform;
+}
+
+bool ProgramReflection::setInt(unsigned int name, int value)
+{
+	bool found;
+	Uniform* target = changed(name, &value, 1, found);
+	if (target != NULL)
+		glUniform1i(target->location, value);
+	return found;
+}
+
+bool ProgramReflection::setUint(unsigned int name, unsigned int value)
+{
+	bool found;
+	Uniform* target = changed(name, &value, 1, found);
+	if (target != NULL)
+		glUniform1ui(target->location, value);
+	return found;
+}
+
+bool ProgramReflection::setFloat(unsigned int name, float value)
+{
+	bool found;
+	Uniform* target = changed(name, &value, 1, found);
+	if (target != NULL)
+		glUniform1f(target->location, value);
+	return found;
+}
+
+bool ProgramReflection::setVec2(unsigned int name, const float* value)
+{
+	bool found;
+	Uniform* target = changed(name, value, 2, found);
+	if (target != NULL)
+		glUniform2fv(target->location, 1, value);
+	return found;
+}
+
+bool ProgramReflection::setVec3(unsigned int name, const float* value)
+{
+	bool found;
+	Uniform* target = changed(name, value, 3, found);
+	if (target != NULL)
+		glUniform3fv(target->location, 1, value);
+	return found;
+}
+
+bool ProgramReflection::setVec4(unsigned int name, const float* value)
+{
+	bool found;
+	Uniform* target = changed(name, value, 4, found);
+	if (target != NULL)
+		glUniform4fv(target->location, 1, value);
+	return found;
+}
+
+bool ProgramReflection::setMat4(unsigned int name, const float* value)
+{
+	bool found;
+	Uniform* target = changed(name, value, 16, found);
+	if (target != NULL)
+		glUniformMatrix4fv(target->location, 1, GL_FALSE, value);
+	return found;
+}
+
+void ProgramReflection::forgetValues()
+{
+	for (size_t i = 0; i < uniformList.size(); i++)
+		uniformList[i].valueKnown = false;
+}
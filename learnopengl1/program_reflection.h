@@ -0,0 +1,124 @@
+#ifndef PROGRAM_REFLECTION_H
+#define PROGRAM_REFLECTION_H
+
+#include <string>
+#include <vector>
+
+// FNV-1a of a uniform, attribute or block name. constexpr, so names written
+// as literals are hashed by the compiler:
+//   static const unsigned int TIME = shaderName("time");
+constexpr unsigned int shaderName(const char* name, unsigned int hash = 2166136261u)
+{
+	return *name == 0 ? hash : shaderName(name + 1, (hash ^ (unsigned char)*name) * 16777619u);
+}
+
+// What a linked program exposes, looked up by hashed name.
+//
+// reflect() asks the driver once for every active uniform, attribute and
+// uniform block (with program interface queries on 4.3, glGetActiveUniform
+// and friends before that) and files them in small open-addressed tables
+// keyed by shaderName(). Arrays are filed under their name without "[0]".
+// Finding a uniform after that is a probe into an array, never a string
+// compare or a glGetUniformLocation.
+//
+// The setters keep the last value sent for every uniform and skip the GL
+// call when a draw sets the same value again. They go to the program that
+// is currently in use, like glUniform*, so bind it first. Values set
+// directly with glUniform* bypass the cache; call forgetValues() after that.
+class ProgramReflection
+{
+public:
+	struct Uniform
+	{
+		std::string name;
+		unsigned int hash;
+		int location;
+		unsigned int type;
+		int arraySize;
+		// Where the uniform's last value is kept, in 32-bit words
+		int valueOffset;
+		int valueWords;
+		bool valueKnown;
+	};
+	struct Attribute
+	{
+		std::string name;
+		unsigned int hash;
+		int location;
+		unsigned int type;
+	};
+	struct Block
+	{
+		std::string name;
+		unsigned int hash;
+		unsigned int index;
+		int size;
+	};
+
+	ProgramReflection();
+
+	// Needs a current context with GL functions loaded. False if the program
+	// isn't linked or two names hash alike (reported, the tables stay empty).
+	bool reflect(unsigned int program);
+
+	// NULL / -1 if the program has no such active name
+	const Uniform* uniform(unsigned int name) const;
+	int uniformLocation(unsigned int name) const;
+	int attributeLocation(unsigned int name) const;
+	int blockIndex(unsigned int name) const;
+
+	// Connect a uniform block to a binding point, false if it isn't active
+	bool bindBlock(unsigned int name, unsigned int binding);
+
+	// False if the uniform isn't active or of another size; skipped calls
+	// still return true
+	bool setInt(unsigned int name, int value);
+	bool setUint(unsigned int name, unsigned int value);
+	bool setFloat(unsigned int name, float value);
+	bool setVec2(unsigned int name, const float* value);
+	bool setVec3(unsigned int name, const float* value);
+	bool setVec4(unsigned int name, const float* value);
+	bool setMat4(unsigned int name, const float* value);
+
+	void forgetValues();
+
+	unsigned int programName() const { return program; }
+	const std::vector<Uniform>& uniforms() const { return uniformList; }
+	const std::vector<Attribute>& attributes() const { return attributeList; }
+	const std::vector<Block>& blocks() const { return blockList; }
+
+	// Setter calls that reached GL, and those dropped as unchanged
+	int uploads() const { return uploadCount; }
+	int skipped() const { return skipCount; }
+
+private:
+	// Open-addressed, power-of-two sized, -1 marks an empty slot
+	struct NameTable
+	{
+		std::vector<unsigned int> hashes;
+		std::vector<int> entries;
+
+		// -1, or the index of a name whose hash is already taken
+		int build(const std::vector<unsigned int>& names);
+		int find(unsigned int hash) const;
+	};
+
+	void reflectInterfaces();
+	void reflectClassic();
+	bool buildTables();
+	// The uniform to send value to, NULL if it is unchanged or not active
+	Uniform* changed(unsigned int name, const void* value, int words, bool& found);
+
+	unsigned int program;
+	std::vector<Uniform> uniformList;
+	std::vector<Attribute> attributeList;
+	std::vector<Block> blockList;
+	NameTable uniformTable;
+	NameTable attributeTable;
+	NameTable blockTable;
+	std::vector<unsigned int> values;
+	int uploadCount;
+	int skipCount;
+};
+
+#endif
@@ -0,0 +1,298 @@
+#include "render_queue.h"
+
+#include <thread>
+#include <glad/glad.h>
+
+#include "job_system.h"
+
+// Below this many draws a single thread sorts faster than several can start
+static const size_t PARALLEL_SORT_MIN = 1 << 16;
+// Fewest entries worth giving a thread of its own
+static const size_t SORT_ITEMS_PER_THREAD = 1 << 15;
+
+// Name no object has, so the first draw always binds
+static const unsigned int UNBOUND = 0xFFFFFFFFu;
+
+unsigned long long makeSortKey(unsigned int pass, unsigned int program, unsigned int material,
+	unsigned int vertexArray, float depth)
+{
+	if (depth < 0.0f)
+		depth = 0.0f;
+	if (depth > 1.0f)
+		depth = 1.0f;
+	unsigned long long depthBits = (unsigned long long)(depth * 0xFFFFF);
+
+	return ((unsigned long long)(pass & 0xF) << 60)
+		| ((unsigned long long)(program & 0xFFF) << 48)
+		| ((unsigned long long)(material & 0xFFFF) << 32)
+		| ((unsigned long long)(vertexArray & 0xFFF) << 20)
+		| depthBits;
+}
+
+DrawItem makeArraysDraw(unsigned int program, unsigned int vertexArray, unsigned int mode, int first, int count)
+{
+	DrawItem item;
+	item.program = program;
+	item.vertexArray = vertexArray;
+	item.material = 0;
+	item.mode = mode;
+	item.indexType = 0;
+	item.first = first;
+	item.count = count;
+	item.baseVertex = 0;
+	return item;
+}
+
+RenderQueue::RenderQueue(int threads)
+	: keyOr(0), keyAnd(~0ULL), maxThreads(threads), jobs(NULL), ownsJobs(false), materialBinder(NULL), materialUser(NULL)
+{
+	if (maxThreads <= 0)
+		maxThreads = (int)std::thread::hardware_concurrency();
+	if (maxThreads <= 0)
+		maxThreads = 1;
+	lastStats.draws = 0;
+	lastStats.programSwitches = 0;
+	lastStats.vertexArraySwitches = 0;
+	lastStats.materialSwitches = 0;
+}
+
+RenderQueue::~RenderQueue()
+{
+	if (ownsJobs)
+		delete jobs;
+}
+
+void RenderQueue::setMaterialBinder(MaterialBinder binder, void* user)
+{
+	materialBinder = binder;
+	materialUser = user;
+}
+
+void RenderQueue::setJobSystem(JobSystem* shared)
+{
+	if (ownsJobs)
+		delete jobs;
+	jobs = shared;
+	ownsJobs = false;
+}
+
+void RenderQueue::begin()
+{
+	items.clear();
+	entries.clear();
+	keyOr = 0;
+	keyAnd = ~0ULL;
+}
+
+void RenderQueue::add(unsigned long long key, const DrawItem& item)
+{
+	Entry entry;
+	entry.key = key;
+	entry.item = (unsigned int)items.size();
+	entry.pad = 0;
+	entries.push_back(entry);
+	items.push_back(item);
+
+	// Bits that differ between any two keys, so sort() can skip the rest
+	keyOr |= key;
+	keyAnd &= key;
+}
+
+void RenderQueue::merge(const std::vector<const RenderQueue*>& sorted)
+{
+	begin();
+	size_t total = 0;
+	for (size_t i = 0; i < sorted.size(); i++)
+		total += sorted[i]->entries.size();
+	items.reserve(total);
+	entries.reserve(total);
+
+	// Few queues (one per thread), so the smallest head is found by scanning
+	std::vector<size_t> heads(sorted.size(), 0);
+	for (size_t n = 0; n < total; n++)
+	{
+		int best = -1;
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			if (heads[i] == sorted[i]->entries.size())
+				continue;
+			if (best < 0 || sorted[i]->entries[heads[i]].key < sorted[best]->entries[heads[best]].key)
+				best = (int)i;
+		}
+		const RenderQueue& queue = *sorted[best];
+		const Entry& entry = queue.entries[heads[best]++];
+		add(entry.key, queue.items[entry.item]);
+	}
+}
+
+// Slice s of every pass is the same contiguous range of entries. Slices
+// scatter in order, so the sort stays stable.
+void RenderQueue::countSlices(void* data, int begin, int end, int)
+{
+	const SortPass& pass = *(const SortPass*)data;
+	size_t count = pass.queue->entries.size();
+	for (int slice = begin; slice < end; slice++)
+	{
+		size_t* histogram = &pass.queue->histograms[slice * 256];
+		for (int digit = 0; digit < 256; digit++)
+			histogram[digit] = 0;
+		size_t last = count * (slice + 1) / pass.slices;
+		for (size_t i = count * slice / pass.slices; i < last; i++)
+			histogram[(pass.source[i].key >> pass.shift) & 0xFF]++;
+	}
+}
+
+void RenderQueue::scatterSlices(void* data, int begin, int end, int)
+{
+	const SortPass& pass = *(const SortPass*)data;
+	size_t count = pass.queue->entries.size();
+	for (int slice = begin; slice < end; slice++)
+	{
+		size_t* offsets = &pass.queue->histograms[slice * 256];
+		size_t last = count * (slice + 1) / pass.slices;
+		for (size_t i = count * slice / pass.slices; i < last; i++)
+			pass.destination[offsets[(pass.source[i].key >> pass.shift) & 0xFF]++] = pass.source[i];
+	}
+}
+
+void RenderQueue::sort()
+{
+	size_t count = entries.size();
+	if (count < 2)
+		return;
+
+	std::vector<int> passes;
+	unsigned long long varying = keyOr & ~keyAnd;
+	for (int byte = 0; byte < 8; byte++)
+	{
+		if ((varying >> (byte * 8)) & 0xFF)
+			passes.push_back(byte);
+	}
+	if (passes.empty())
+		return;
+
+	int slices = 1;
+	if (count >= PARALLEL_SORT_MIN)
+	{
+		slices = (int)(count / SORT_ITEMS_PER_THREAD);
+		if (slices > maxThreads)
+			slices = maxThreads;
+		if (slices < 1)
+			slices = 1;
+	}
+
+	// Threads are started once and kept, not once per frame
+	if (slices > 1 && jobs == NULL)
+	{
+		jobs = new JobSystem(maxThreads);
+		ownsJobs = true;
+	}
+	if (jobs != NULL && slices > jobs->threadCount())
+		slices = jobs->threadCount();
+
+	scratch.resize(count);
+	histograms.resize(slices * 256);
+
+	for (size_t p = 0; p < passes.size(); p++)
+	{
+		SortPass pass;
+		pass.queue = this;
+		pass.source = p % 2 == 0 ? entries.data() : scratch.data();
+		pass.destination = p % 2 == 0 ? scratch.data() : entries.data();
+		pass.shift = passes[p] * 8;
+		pass.slices = slices;
+
+		if (slices == 1)
+			countSlices(&pass, 0, 1, 0);
+		else
+			jobs->parallelFor(slices, 1, countSlices, &pass);
+
+		// Each slice writes a digit after all smaller digits and after the
+		// same digit of the slices before it
+		size_t total = 0;
+		for (int digit = 0; digit < 256; digit++)
+		{
+			for (int slice = 0; slice < slices; slice++)
+			{
+				size_t digitCount = histograms[slice * 256 + digit];
+				histograms[slice * 256 + digit] = total;
+				total += digitCount;
+			}
+		}
+
+		if (slices == 1)
+			scatterSlices(&pass, 0, 1, 0);
+		else
+			jobs->parallelFor(slices, 1, scatterSlices, &pass);
+	}
+
+	// An odd number of passes leaves the result in the scratch buffer
+	if (passes.size() % 2 == 1)
+		entries.swap(scratch);
+}
+
+QueueStats RenderQueue::walk(bool draw) const
+{
+	QueueStats stats;
+	stats.draws = 0;
+	stats.programSwitches = 0;
+	stats.vertexArraySwitches = 0;
+	stats.materialSwitches = 0;
+
+	unsigned int program = UNBOUND;
+	unsigned int vertexArray = UNBOUND;
+	unsigned int material = UNBOUND;
+
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const DrawItem& item = items[entries[i].item];
+
+		if (item.program != program)
+		{
+			program = item.program;
+			stats.programSwitches++;
+			if (draw)
+				glUseProgram(program);
+		}
+		if (item.vertexArray != vertexArray)
+		{
+			vertexArray = item.vertexArray;
+			stats.vertexArraySwitches++;
+			if (draw)
+				glBindVertexArray(vertexArray);
+		}
+		if (item.material != material && materialBinder != NULL)
+		{
+			material = item.material;
+			stats.materialSwitches++;
+			if (draw)
+				materialBinder(material, materialUser);
+		}
+		stats.draws++;
+
+		if (!draw)
+			continue;
+		if (item.indexType == 0)
+			glDrawArrays(item.mode, item.first, item.count);
+		else
+		{
+			size_t indexSize = item.indexType == GL_UNSIGNED_SHORT ? 2 : item.indexType == GL_UNSIGNED_BYTE ? 1 : 4;
+			const void* offset = (const void*)(item.first * indexSize);
+			if (item.baseVertex != 0)
+				glDrawElementsBaseVertex(item.mode, item.count, item.indexType, offset, item.baseVertex);
+			else
+				glDrawElements(item.mode, item.count, item.indexType, offset);
+		}
+	}
+	return stats;
+}
+
+void RenderQueue::submit()
+{
+	lastStats = walk(true);
+}
+
+QueueStats RenderQueue::countSwitches() const
+{
+	return walk(false);
+}
@@ -0,0 +1,126 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <cstddef>
+#include <vector>
+
+// 64-bit sort key, most significant field first:
+//   pass 4 | program 12 | material 16 | vertex array 12 | depth 20
+// Sorting by it groups draws by pass, then program, then material, then
+// vertex array, and orders each group by depth. Ids wider than their field
+// are masked; that only costs grouping, the draw item still carries the
+// real names.
+unsigned long long makeSortKey(unsigned int pass, unsigned int program, unsigned int material,
+	unsigned int vertexArray, float depth);
+
+// One draw, everything needed to submit it
+struct DrawItem
+{
+	unsigned int program;
+	unsigned int vertexArray;
+	// Handed to the material binder whenever it changes
+	unsigned int material;
+	unsigned int mode;
+	// 0 for glDrawArrays, else the index type of glDrawElements
+	unsigned int indexType;
+	// First vertex, or first index for indexed draws
+	int first;
+	int count;
+	int baseVertex;
+};
+
+DrawItem makeArraysDraw(unsigned int program, unsigned int vertexArray, unsigned int mode, int first, int count);
+
+// State changes a submission made (or would make, see countSwitches)
+struct QueueStats
+{
+	int draws;
+	int programSwitches;
+	int vertexArraySwitches;
+	int materialSwitches;
+};
+
+typedef void (*MaterialBinder)(unsigned int material, void* user);
+
+class JobSystem;
+
+// Draws are collected with their keys during the frame, radix sorted, and
+// submitted in key order, only binding what changed between neighbours.
+class RenderQueue
+{
+public:
+	// threads is the most the sort uses, 0 for one per hardware thread
+	RenderQueue(int threads = 0);
+	~RenderQueue();
+
+	void setMaterialBinder(MaterialBinder binder, void* user);
+
+	// Sort on a job system shared with the rest of the frame instead of a
+	// pool of the queue's own (NULL goes back to that). sort() must then be
+	// called from the thread that owns it.
+	void setJobSystem(JobSystem* jobs);
+
+	void begin();
+	void add(unsigned long long key, const DrawItem& item);
+
+	// Stable LSD radix sort by key. Byte passes on which every key agrees are
+	// skipped, and large queues are split across threads. The queue's own
+	// threads are started by the first sort that needs them and kept.
+	void sort();
+
+	// Replace the contents with those of queues that are each sorted already,
+	// merged in key order (equal keys keep the order of the queues). Lets
+	// threads fill and sort their own queues and leaves one merge pass.
+	void merge(const std::vector<const RenderQueue*>& sorted);
+
+	// Draw everything in the current order (submission order until sorted)
+	void submit();
+
+	// What submit() would do, without touching GL
+	QueueStats countSwitches() const;
+
+	size_t size() const { return entries.size(); }
+	const QueueStats& stats() const { return lastStats; }
+
+private:
+	struct Entry
+	{
+		unsigned long long key;
+		unsigned int item;
+		unsigned int pad;
+	};
+
+	// One byte of the key, sorted by slices counting and then scattering
+	struct SortPass
+	{
+		RenderQueue* queue;
+		const Entry* source;
+		Entry* destination;
+		int shift;
+		int slices;
+	};
+
+	RenderQueue(const RenderQueue&) = delete;
+	RenderQueue& operator=(const RenderQueue&) = delete;
+
+	QueueStats walk(bool draw) const;
+	static void countSlices(void* data, int begin, int end, int worker);
+	static void scatterSlices(void* data, int begin, int end, int worker);
+
+	std::vector<DrawItem> items;
+	std::vector<Entry> entries;
+	std::vector<Entry> scratch;
+	// 256 counts per slice, turned into write offsets before scattering
+	std::vector<size_t> histograms;
+	unsigned long long keyOr;
+	unsigned long long keyAnd;
+	int maxThreads;
+	JobSystem* jobs;
+	bool ownsJobs;
+
+	MaterialBinder materialBinder;
+	void* materialUser;
+	QueueStats lastStats;
+};
+
+#endif
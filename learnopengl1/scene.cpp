@@ -0,0 +1,356 @@
+#include "scene.h"
+
+#include <iostream>
+#include <vector>
+#include <glad/glad.h>
+#include "batcher.h"
+#include "indirect.h"
+#include "instancing.h"
+#include "material_system.h"
+#include "program_cache.h"
+#include "render_queue.h"
+#include "shader.h"
+#include "shader_variants.h"
+
+// Colors of the two triangles, included by the fragment shader
+const char* colorsSource =
+	"const vec4 orange = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+	"const vec4 yellow = vec4(0.9f, 0.9f, 0.1f, 1.0f);\n";
+
+// string with fragment shader code, specialized per triangle by YELLOW
+const char* fragmentShaderSource = "#version 330 core\n"
+	"#include \"colors.glsl\"\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"#ifdef YELLOW\n"
+	"	FragColor = yellow;\n"
+	"#else\n"
+	"	FragColor = orange;\n"
+	"#endif\n"
+	"}\0";
+
+// string with our vertex shader code
+const char* vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+	"}\0";
+
+// The same shaders as SPIR-V modules, compiled at build time from
+// shaders/scene.vert and shaders/scene.frag. Without them --spirv falls
+// back to the GLSL above.
+#ifndef SCENE_SPIRV_DIR
+#define SCENE_SPIRV_DIR "shaders"
+#endif
+
+// Both triangle programs from one source, the second with YELLOW on
+static void createSceneShaders(Scene& scene)
+{
+	scene.shaders = new ShaderVariants(vertexShaderSource, fragmentShaderSource);
+	scene.shaders->addInclude("colors.glsl", colorsSource);
+	scene.programKeys[0] = 0;
+	scene.programKeys[1] = scene.shaders->addFeature("YELLOW");
+}
+
+// One program for both triangles, the color comes from the Material block
+const char* materialVertexShaderSource = "#version 330 core\n"
+	"#include \"material_blocks.glsl\"\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = viewProjection * vec4(aPos, 1.0);\n"
+	"}\0";
+
+const char* materialFragmentShaderSource = "#version 330 core\n"
+	"#include \"material_blocks.glsl\"\n"
+	"out vec4 FragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	FragColor = color;\n"
+	"}\0";
+
+static std::string sceneMaterialSource(unsigned int stage)
+{
+	ShaderVariants shaders(materialVertexShaderSource, materialFragmentShaderSource);
+	shaders.addInclude("material_blocks.glsl", materialBlocksSource);
+	return shaders.source(stage, 0);
+}
+
+// Vertices for two triangles
+static const float vertices1[] = {
+	-0.5f, 0.5f, 0.0f,
+	-0.5f, -0.5f, 0.0f,
+	-0.1f, 0.0f, 0.0f
+};
+static const float vertices2[] = {
+	0.5f, 0.5f, 0.0f,
+	0.5f, -0.5f, 0.0f,
+	0.1f, 0.0f, 0.0f
+};
+
+static void createSceneGeometry(Scene& scene)
+{
+	// Bind VAO so we don't have to set up the vertex attributes each time
+	glGenVertexArrays(2, scene.VAOs);
+
+	glBindVertexArray(scene.VAOs[0]);
+
+	// Create a vertex buffer object for sending data to GPU memory
+	glGenBuffers(2, scene.VBOs); // Buffer IDs
+
+	glBindBuffer(GL_ARRAY_BUFFER, scene.VBOs[0]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices1), vertices1, GL_STATIC_DRAW);
+
+	// Tell OpenGL how to interpret the vertex array 
+	// (vertex attribute is at location 0, size 3, float type, normalised, stride,
+	// first value at start of buffer)
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+
+	glBindVertexArray(scene.VAOs[1]);
+
+	glBindBuffer(GL_ARRAY_BUFFER, scene.VBOs[1]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	// Background color
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+	// Wireframe mode
+	//glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+}
+
+bool createScene(Scene& scene, ProgramCache* cache)
+{
+	createSceneShaders(scene);
+	if (cache != NULL)
+	{
+		// The cache is keyed on the sources; the programs it returns are the
+		// scene's own and destroyScene deletes them
+		ShaderVariants& shaders = *scene.shaders;
+		unsigned int programs[2];
+		for (int i = 0; i < 2; i++)
+			programs[i] = cache->getProgram(shaders.source(GL_VERTEX_SHADER, scene.programKeys[i]).c_str(),
+				shaders.source(GL_FRAGMENT_SHADER, scene.programKeys[i]).c_str());
+		scene.shaderProgram1 = programs[0];
+		scene.shaderProgram2 = programs[1];
+		delete scene.shaders;
+		scene.shaders = NULL;
+	}
+	else
+	{
+		// Both programs are prepared before either is waited for, so the
+		// driver can compile them together (the shared vertex shader only once)
+		scene.shaders->init(false);
+		scene.shaders->prepare(scene.programKeys[0]);
+		scene.shaders->prepare(scene.programKeys[1]);
+		scene.shaderProgram1 = scene.shaders->program(scene.programKeys[0]);
+		scene.shaderProgram2 = scene.shaders->program(scene.programKeys[1]);
+	}
+
+	createSceneGeometry(scene);
+	return scene.shaderProgram1 != 0 && scene.shaderProgram2 != 0;
+}
+
+bool createSceneSpirv(Scene& scene)
+{
+	std::vector<unsigned int> vertexModule;
+	std::vector<unsigned int> fragmentModule;
+	if (!spirvSupported() || !loadSpirvModule(SCENE_SPIRV_DIR "/scene.vert.spv", vertexModule)
+		|| !loadSpirvModule(SCENE_SPIRV_DIR "/scene.frag.spv", fragmentModule))
+		return false;
+	size_t vertexSize = vertexModule.size() * sizeof(unsigned int);
+	size_t fragmentSize = fragmentModule.size() * sizeof(unsigned int);
+
+	// One fragment module specialized with each triangle's color
+	SpecializationConstants orange;
+	orange.setFloat(0, 1.0f);
+	orange.setFloat(1, 0.5f);
+	orange.setFloat(2, 0.2f);
+	SpecializationConstants yellow;
+	yellow.setFloat(0, 0.9f);
+	yellow.setFloat(1, 0.9f);
+	yellow.setFloat(2, 0.1f);
+
+	scene.shaderProgram1 = createSpirvProgram(&vertexModule[0], vertexSize, &fragmentModule[0], fragmentSize, NULL, &orange);
+	scene.shaderProgram2 = createSpirvProgram(&vertexModule[0], vertexSize, &fragmentModule[0], fragmentSize, NULL, &yellow);
+	if (scene.shaderProgram1 == 0 || scene.shaderProgram2 == 0)
+	{
+		glDeleteProgram(scene.shaderProgram1);
+		glDeleteProgram(scene.shaderProgram2);
+		return false;
+	}
+	scene.shaders = NULL;
+
+	createSceneGeometry(scene);
+	return true;
+}
+
+bool createSceneMaterials(Scene& scene, MaterialSystem& materials)
+{
+	unsigned int program = createProgram(sceneMaterialSource(GL_VERTEX_SHADER).c_str(),
+		sceneMaterialSource(GL_FRAGMENT_SHADER).c_str());
+	if (program == 0)
+		return false;
+	bindMaterialBlocks(program);
+	scene.shaderProgram1 = program;
+	scene.shaderProgram2 = program;
+	scene.shaders = NULL;
+
+	MaterialUniforms orange = { { 1.0f, 0.5f, 0.2f, 1.0f } };
+	MaterialUniforms yellow = { { 0.9f, 0.9f, 0.1f, 1.0f } };
+	scene.materials[0] = materials.addMaterial(orange);
+	scene.materials[1] = materials.addMaterial(yellow);
+	if (scene.materials[0] < 0 || scene.materials[1] < 0)
+	{
+		glDeleteProgram(program);
+		return false;
+	}
+
+	createSceneGeometry(scene);
+	return true;
+}
+
+void createSceneDeferred(Scene& scene)
+{
+	createSceneShaders(scene);
+	scene.shaders->init();
+	scene.shaders->prepare(scene.programKeys[0]);
+	scene.shaders->prepare(scene.programKeys[1]);
+	scene.shaderProgram1 = 0;
+	scene.shaderProgram2 = 0;
+	createSceneGeometry(scene);
+}
+
+bool updateScenePrograms(Scene& scene)
+{
+	ShaderVariants& shaders = *scene.shaders;
+	shaders.poll();
+	if (scene.shaderProgram1 == 0 && shaders.ready(scene.programKeys[0]))
+		scene.shaderProgram1 = shaders.program(scene.programKeys[0]);
+	if (scene.shaderProgram2 == 0 && shaders.ready(scene.programKeys[1]))
+		scene.shaderProgram2 = shaders.program(scene.programKeys[1]);
+	return shaders.ready(scene.programKeys[0]) && shaders.ready(scene.programKeys[1]);
+}
+
+void drawScene(const Scene& scene)
+{
+	// Triangles whose program is still building are left out for now
+	glClear(GL_COLOR_BUFFER_BIT);
+	if (scene.shaderProgram1 != 0)
+	{
+		glUseProgram(scene.shaderProgram1);
+		glBindVertexArray(scene.VAOs[0]);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+	if (scene.shaderProgram2 != 0)
+	{
+		glUseProgram(scene.shaderProgram2);
+		glBindVertexArray(scene.VAOs[1]);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+}
+
+void drawSceneBatched(Batcher& batcher)
+{
+	// Colors match the two fragment shaders
+	glClear(GL_COLOR_BUFFER_BIT);
+	batcher.begin();
+	batcher.addTriangle(vertices1, packColor(1.0f, 0.5f, 0.2f));
+	batcher.addTriangle(vertices2, packColor(0.9f, 0.9f, 0.1f));
+	batcher.flush();
+}
+
+bool createSceneMesh(InstancedMesh& mesh)
+{
+	// vertices2 is vertices1 mirrored in x, so one triangle serves both
+	return mesh.init(vertices1, 3);
+}
+
+void drawSceneInstanced(InstancedMesh& mesh)
+{
+	glClear(GL_COLOR_BUFFER_BIT);
+	mesh.begin();
+	mesh.add(makeInstance(0.0f, 0.0f, 1.0f, 1.0f, packColor(1.0f, 0.5f, 0.2f)));
+	mesh.add(makeInstance(0.0f, 0.0f, -1.0f, 1.0f, packColor(0.9f, 0.9f, 0.1f)));
+	mesh.flush();
+}
+
+bool createSceneIndirect(IndirectRenderer& renderer)
+{
+	renderer.addMesh(buildIndexedMesh(vertices1, 3, 3));
+	return renderer.init();
+}
+
+void drawSceneIndirect(IndirectRenderer& renderer)
+{
+	glClear(GL_COLOR_BUFFER_BIT);
+	renderer.begin();
+	renderer.add(0, makeInstance(0.0f, 0.0f, 1.0f, 1.0f, packColor(1.0f, 0.5f, 0.2f)));
+	renderer.add(0, makeInstance(0.0f, 0.0f, -1.0f, 1.0f, packColor(0.9f, 0.9f, 0.1f)));
+	renderer.flush();
+}
+
+void drawSceneQueued(const Scene& scene, RenderQueue& queue)
+{
+	// Submission order no longer matters, the keys decide it
+	glClear(GL_COLOR_BUFFER_BIT);
+	queue.begin();
+	queue.add(makeSortKey(0, scene.shaderProgram2, 0, scene.VAOs[1], 0.0f),
+		makeArraysDraw(scene.shaderProgram2, scene.VAOs[1], GL_TRIANGLES, 0, 3));
+	queue.add(makeSortKey(0, scene.shaderProgram1, 0, scene.VAOs[0], 0.0f),
+		makeArraysDraw(scene.shaderProgram1, scene.VAOs[0], GL_TRIANGLES, 0, 3));
+	queue.sort();
+	queue.submit();
+}
+
+void drawSceneMaterials(const Scene& scene, MaterialSystem& materials, RenderQueue& queue, float time)
+{
+	// The camera doesn't move, but the block is refreshed every frame all the same
+	FrameUniforms frame = {
+		{ 1.0f, 0.0f, 0.0f, 0.0f,
+		  0.0f, 1.0f, 0.0f, 0.0f,
+		  0.0f, 0.0f, 1.0f, 0.0f,
+		  0.0f, 0.0f, 0.0f, 1.0f },
+		time,
+		{ 0.0f, 0.0f, 0.0f }
+	};
+	materials.beginFrame(frame);
+
+	// Same program, so the queue only switches the material range in between
+	glClear(GL_COLOR_BUFFER_BIT);
+	queue.setMaterialBinder(MaterialSystem::materialBinder, &materials);
+	queue.begin();
+	for (int i = 0; i < 2; i++)
+	{
+		DrawItem item = makeArraysDraw(scene.shaderProgram1, scene.VAOs[i], GL_TRIANGLES, 0, 3);
+		item.material = scene.materials[i];
+		queue.add(makeSortKey(0, item.program, item.material, item.vertexArray, 0.0f), item);
+	}
+	queue.sort();
+	queue.submit();
+}
+
+void destroyScene(Scene& scene)
+{
+	glDeleteVertexArrays(2, scene.VAOs);
+	glDeleteBuffers(2, scene.VBOs);
+	if (scene.shaders != NULL)
+	{
+		// Finishes programs still building and deletes them all
+		scene.shaders->destroy();
+		delete scene.shaders;
+		scene.shaders = NULL;
+	}
+	else
+	{
+		glDeleteProgram(scene.shaderProgram1);
+		if (scene.shaderProgram2 != scene.shaderProgram1)
+			glDeleteProgram(scene.shaderProgram2);
+	}
+}
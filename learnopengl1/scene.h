@@ -0,0 +1,78 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <cstddef>
+
+class Batcher;
+class IndirectRenderer;
+class InstancedMesh;
+class MaterialSystem;
+class ProgramCache;
+class RenderQueue;
+class ShaderVariants;
+
+// The two triangles drawn every frame, with their programs and buffers.
+// Everything lives in the context that is current when createScene runs.
+struct Scene
+{
+	unsigned int shaderProgram1;
+	unsigned int shaderProgram2;
+	unsigned int VAOs[2];
+	unsigned int VBOs[2];
+	// Variants the two programs were built from, which also own them;
+	// NULL when the scene owns its programs itself
+	ShaderVariants* shaders;
+	unsigned int programKeys[2];
+	// Material ids when made by createSceneMaterials (both share program 1)
+	int materials[2];
+};
+
+// Compile the shaders and upload the vertices, returns false on shader errors.
+// With a cache the programs are restored from disk when possible.
+bool createScene(Scene& scene, ProgramCache* cache = NULL);
+
+// Same with the programs made from precompiled SPIR-V modules, specialized
+// with each triangle's color. Returns false, with nothing created, if
+// the context can't take SPIR-V or the modules are rejected.
+bool createSceneSpirv(Scene& scene);
+
+// Same with one program for both triangles, their colors added to the
+// material system as two materials. Returns false, with nothing created,
+// if the program or the materials fail.
+bool createSceneMaterials(Scene& scene, MaterialSystem& materials);
+
+// Same, but the programs are only prepared. Until updateScenePrograms
+// picks them up, drawScene leaves their triangles out.
+void createSceneDeferred(Scene& scene);
+
+// Poll the programs once (call every frame), true once both are in
+bool updateScenePrograms(Scene& scene);
+
+// Clear and draw one frame
+void drawScene(const Scene& scene);
+
+// Same frame with both triangles in one batched draw call
+void drawSceneBatched(Batcher& batcher);
+
+// Upload the shared triangle for drawSceneInstanced
+bool createSceneMesh(InstancedMesh& mesh);
+
+// Same frame as two instances of one triangle in one instanced draw call
+void drawSceneInstanced(InstancedMesh& mesh);
+
+// Set up the shared triangle for drawSceneIndirect in the best supported mode
+bool createSceneIndirect(IndirectRenderer& renderer);
+
+// Same frame as one multi-draw of indirect commands (or its 3.3 fallback)
+void drawSceneIndirect(IndirectRenderer& renderer);
+
+// Same frame submitted through a sort-key render queue
+void drawSceneQueued(const Scene& scene, RenderQueue& queue);
+
+// Same frame with the per-frame block updated, drawn through the queue with
+// the materials bound by range
+void drawSceneMaterials(const Scene& scene, MaterialSystem& materials, RenderQueue& queue, float time);
+
+void destroyScene(Scene& scene);
+
+#endif
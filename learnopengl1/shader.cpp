@@ -0,0 +1,188 @@
+#include "shader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "glad_ext.h"
+
+static unsigned int compileShader(unsigned int type, const char* source)
+{
+	unsigned int shader = glCreateShader(type);
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+
+	// Check for compile errors
+	int success;
+	char infolog[512];
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		glGetShaderInfoLog(shader, 512, NULL, infolog);
+		const char* stage = type == GL_VERTEX_SHADER ? "VERTEX" : type == GL_FRAGMENT_SHADER ? "FRAGMENT" : "COMPUTE";
+		std::cout << "ERROR::SHADER::" << stage << "::COMPILATION_FAILED\n" << infolog << std::endl;
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+static unsigned int linkProgram(unsigned int firstShader, unsigned int secondShader, bool retrievable)
+{
+	unsigned int program = glCreateProgram();
+	glAttachShader(program, firstShader);
+	if (secondShader != 0)
+		glAttachShader(program, secondShader);
+	if (retrievable && gladGLProc("glProgramParameteri") != NULL)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(program);
+
+	// The program keeps the compiled stages alive
+	glDeleteShader(firstShader);
+	glDeleteShader(secondShader);
+
+	int success;
+	char infolog[512];
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glGetProgramInfoLog(program, 512, NULL, infolog);
+		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infolog << std::endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+unsigned int createProgram(const char* vertexSource, const char* fragmentSource, bool retrievable)
+{
+	unsigned int vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
+	unsigned int fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+	if (vertexShader == 0 || fragmentShader == 0)
+	{
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+		return 0;
+	}
+
+	return linkProgram(vertexShader, fragmentShader, retrievable);
+}
+
+unsigned int createComputeProgram(const char* computeSource)
+{
+	unsigned int computeShader = compileShader(GL_COMPUTE_SHADER, computeSource);
+	if (computeShader == 0)
+		return 0;
+	return linkProgram(computeShader, 0, false);
+}
+
+void SpecializationConstants::setFloat(unsigned int id, float value)
+{
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	ids.push_back(id);
+	values.push_back(bits);
+}
+
+void SpecializationConstants::setInt(unsigned int id, int value)
+{
+	ids.push_back(id);
+	values.push_back((unsigned int)value);
+}
+
+void SpecializationConstants::setBool(unsigned int id, bool value)
+{
+	ids.push_back(id);
+	values.push_back(value ? 1u : 0u);
+}
+
+// Core entry point on 4.6, the ARB one (same signature) before that
+static PFNGLSPECIALIZESHADERPROC specializeShaderProc()
+{
+	if (GLAD_GL_VERSION_4_6 && gladGLProc("glSpecializeShader") != NULL)
+		return glad_glSpecializeShader;
+	if (gladHasExtension("GL_ARB_gl_spirv"))
+		return (PFNGLSPECIALIZESHADERPROC)gladGetExtensionProc("glSpecializeShaderARB");
+	return NULL;
+}
+
+// Modules are handed over with glShaderBinary, which glad only loads for
+// 4.1; before that it comes with ARB_ES2_compatibility under the same name
+static bool loadShaderBinary()
+{
+	if (gladGLProc("glShaderBinary") == NULL && gladHasExtension("GL_ARB_ES2_compatibility"))
+		gladSetGLProc("glShaderBinary", gladGetExtensionProc("glShaderBinary"));
+	return gladGLProc("glShaderBinary") != NULL;
+}
+
+bool spirvSupported()
+{
+	return loadShaderBinary() && specializeShaderProc() != NULL;
+}
+
+bool loadSpirvModule(const char* path, std::vector<unsigned int>& words)
+{
+	words.clear();
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		std::cout << "ERROR::SHADER::SPIRV::FILE_NOT_FOUND " << path << std::endl;
+		return false;
+	}
+	unsigned int word;
+	while (fread(&word, sizeof(word), 1, file) == 1)
+		words.push_back(word);
+	fclose(file);
+
+	// Modules are whole words starting with the magic number
+	if (words.size() < 5 || words[0] != 0x07230203)
+	{
+		std::cout << "ERROR::SHADER::SPIRV::INVALID_MODULE " << path << std::endl;
+		words.clear();
+		return false;
+	}
+	return true;
+}
+
+static unsigned int specializeShader(PFNGLSPECIALIZESHADERPROC specialize, unsigned int type,
+	const unsigned int* module, size_t size, const SpecializationConstants* constants)
+{
+	// The module replaces the source; specializing takes the place of compiling
+	unsigned int shader = glCreateShader(type);
+	glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, module, (GLsizei)size);
+	bool hasConstants = constants != NULL && !constants->ids.empty();
+	specialize(shader, "main", hasConstants ? (GLuint)constants->ids.size() : 0,
+		hasConstants ? &constants->ids[0] : NULL, hasConstants ? &constants->values[0] : NULL);
+
+	int success;
+	char infolog[512];
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		glGetShaderInfoLog(shader, 512, NULL, infolog);
+		const char* stage = type == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT";
+		std::cout << "ERROR::SHADER::" << stage << "::SPECIALIZATION_FAILED\n" << infolog << std::endl;
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+unsigned int createSpirvProgram(const unsigned int* vertexModule, size_t vertexSize,
+	const unsigned int* fragmentModule, size_t fragmentSize,
+	const SpecializationConstants* vertexConstants, const SpecializationConstants* fragmentConstants)
+{
+	PFNGLSPECIALIZESHADERPROC specialize = specializeShaderProc();
+	if (specialize == NULL || !loadShaderBinary())
+		return 0;
+
+	unsigned int vertexShader = specializeShader(specialize, GL_VERTEX_SHADER, vertexModule, vertexSize, vertexConstants);
+	unsigned int fragmentShader = specializeShader(specialize, GL_FRAGMENT_SHADER, fragmentModule, fragmentSize, fragmentConstants);
+	if (vertexShader == 0 || fragmentShader == 0)
+	{
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+		return 0;
+	}
+
+	return linkProgram(vertexShader, fragmentShader, false);
+}
@@ -0,0 +1,42 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <cstddef>
+#include <vector>
+
+// Compile and link a vertex + fragment shader pair. Errors are printed with
+// the shader's info log; returns 0 if either stage or the link failed.
+// retrievable asks the driver to keep the binary for glGetProgramBinary.
+unsigned int createProgram(const char* vertexSource, const char* fragmentSource, bool retrievable = false);
+
+// Same for a compute shader (needs GL 4.3)
+unsigned int createComputeProgram(const char* computeSource);
+
+// Values for the specialization constants of a SPIR-V module, by SpecId.
+// Whatever isn't set keeps the default compiled into the module.
+struct SpecializationConstants
+{
+	std::vector<unsigned int> ids;
+	std::vector<unsigned int> values;
+
+	void setFloat(unsigned int id, float value);
+	void setInt(unsigned int id, int value);
+	void setBool(unsigned int id, bool value);
+};
+
+// True if the context takes SPIR-V modules (GL 4.6 or ARB_gl_spirv, plus
+// glShaderBinary from 4.1 or ARB_ES2_compatibility)
+bool spirvSupported();
+
+// Read a SPIR-V module from disk, false (with an error printed) if the file
+// is missing or doesn't hold a module
+bool loadSpirvModule(const char* path, std::vector<unsigned int>& words);
+
+// Link a program from SPIR-V vertex and fragment modules (sizes in bytes),
+// each specialized with its constants (may be NULL) at entry point "main".
+// Returns 0 without SPIR-V support or if either stage or the link failed.
+unsigned int createSpirvProgram(const unsigned int* vertexModule, size_t vertexSize,
+	const unsigned int* fragmentModule, size_t fragmentSize,
+	const SpecializationConstants* vertexConstants = NULL, const SpecializationConstants* fragmentConstants = NULL);
+
+#endif
@@ -0,0 +1,209 @@
+#include "shader_builder.h"
+
+#include <iostream>
+#include "glad_ext.h"
+
+// Not part of the core-only generated loader
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+typedef void (APIENTRY* MaxShaderCompilerThreadsProc)(GLuint count);
+
+ShaderBuilder::ShaderBuilder()
+	: pending(0), failures(0), parallelCompile(false), warmUp(false), warmVAO(0)
+{
+}
+
+void ShaderBuilder::init(bool warm)
+{
+	warmUp = warm;
+	if (warmUp)
+		glGenVertexArrays(1, &warmVAO);
+
+	const char* threadsEntry = NULL;
+	if (gladHasExtension("GL_KHR_parallel_shader_compile"))
+		threadsEntry = "glMaxShaderCompilerThreadsKHR";
+	else if (gladHasExtension("GL_ARB_parallel_shader_compile"))
+		threadsEntry = "glMaxShaderCompilerThreadsARB";
+	if (threadsEntry == NULL)
+		return;
+
+	// Let the driver pick how many compiler threads to use
+	MaxShaderCompilerThreadsProc maxThreads = (MaxShaderCompilerThreadsProc)gladGetExtensionProc(threadsEntry);
+	if (maxThreads != NULL)
+		maxThreads(0xFFFFFFFFu);
+	parallelCompile = true;
+}
+
+void ShaderBuilder::destroy()
+{
+	// Whatever is still building is collected, the programs stay the caller's
+	finish();
+	jobs.clear();
+	if (warmVAO != 0)
+		glDeleteVertexArrays(1, &warmVAO);
+	warmVAO = 0;
+	failures = 0;
+}
+
+std::string ShaderBuilder::acquireShader(unsigned int type, const char* source)
+{
+	std::string key = (type == GL_VERTEX_SHADER ? "v:" : "f:") + std::string(source);
+	std::map<std::string, SharedShader>::iterator found = shaders.find(key);
+	if (found != shaders.end())
+	{
+		found->second.users++;
+		return key;
+	}
+
+	SharedShader shader;
+	shader.name = glCreateShader(type);
+	shader.users = 1;
+	glShaderSource(shader.name, 1, &source, NULL);
+	glCompileShader(shader.name);
+	shaders[key] = shader;
+	return key;
+}
+
+void ShaderBuilder::releaseShader(const std::string& key)
+{
+	std::map<std::string, SharedShader>::iterator found = shaders.find(key);
+	if (found == shaders.end() || --found->second.users > 0)
+		return;
+
+	// Programs linked from it keep it alive as long as they need it
+	glDeleteShader(found->second.name);
+	shaders.erase(found);
+}
+
+int ShaderBuilder::add(const char* vertexSource, const char* fragmentSource)
+{
+	Job job;
+	job.shaderKeys[0] = acquireShader(GL_VERTEX_SHADER, vertexSource);
+	job.shaderKeys[1] = acquireShader(GL_FRAGMENT_SHADER, fragmentSource);
+	job.done = false;
+
+	// Linking doesn't wait for the compiles to be checked; a failed compile
+	// shows up as a failed link when the job is collected
+	job.program = glCreateProgram();
+	glAttachShader(job.program, shaders[job.shaderKeys[0]].name);
+	glAttachShader(job.program, shaders[job.shaderKeys[1]].name);
+	glLinkProgram(job.program);
+
+	jobs.push_back(job);
+	pending++;
+	return (int)jobs.size() - 1;
+}
+
+void ShaderBuilder::collect(Job& job)
+{
+	int success;
+	char infolog[512];
+	glGetProgramiv(job.program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		// Report the stage that broke it, or the link itself
+		bool compileFailed = false;
+		for (int i = 0; i < 2; i++)
+		{
+			unsigned int shader = shaders[job.shaderKeys[i]].name;
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+			if (!success)
+			{
+				glGetShaderInfoLog(shader, 512, NULL, infolog);
+				std::cout << "ERROR::SHADER::" << (i == 0 ? "VERTEX" : "FRAGMENT") << "::COMPILATION_FAILED\n" << infolog << std::endl;
+				compileFailed = true;
+			}
+		}
+		if (!compileFailed)
+		{
+			glGetProgramInfoLog(job.program, 512, NULL, infolog);
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infolog << std::endl;
+		}
+		glDeleteProgram(job.program);
+		job.program = 0;
+		failures++;
+	}
+	else
+	{
+		job.reflection.reflect(job.program);
+		if (warmUp)
+			warm(job.program);
+	}
+
+	releaseShader(job.shaderKeys[0]);
+	releaseShader(job.shaderKeys[1]);
+	job.done = true;
+	pending--;
+}
+
+void ShaderBuilder::warm(unsigned int program)
+{
+	glEnable(GL_RASTERIZER_DISCARD);
+	glUseProgram(program);
+	glBindVertexArray(warmVAO);
+	glDrawArrays(GL_POINTS, 0, 1);
+	glBindVertexArray(0);
+	glUseProgram(0);
+	glDisable(GL_RASTERIZER_DISCARD);
+}
+
+int ShaderBuilder::poll(int maxBlocking)
+{
+	for (size_t i = 0; i < jobs.size() && parallelCompile; i++)
+	{
+		if (jobs[i].done)
+			continue;
+		int complete = 0;
+		glGetProgramiv(jobs[i].program, GL_COMPLETION_STATUS_KHR, &complete);
+		if (complete)
+			collect(jobs[i]);
+	}
+
+	for (size_t i = 0; i < jobs.size() && !parallelCompile && maxBlocking > 0; i++)
+	{
+		if (jobs[i].done)
+			continue;
+		collect(jobs[i]);
+		maxBlocking--;
+	}
+	return pending;
+}
+
+bool ShaderBuilder::finish()
+{
+	for (size_t i = 0; i < jobs.size(); i++)
+	{
+		if (!jobs[i].done)
+			collect(jobs[i]);
+	}
+	return failures == 0;
+}
+
+unsigned int ShaderBuilder::wait(int handle)
+{
+	if (handle < 0 || handle >= (int)jobs.size())
+		return 0;
+	if (!jobs[handle].done)
+		collect(jobs[handle]);
+	return jobs[handle].program;
+}
+
+unsigned int ShaderBuilder::program(int handle) const
+{
+	if (handle < 0 || handle >= (int)jobs.size() || !jobs[handle].done)
+		return 0;
+	return jobs[handle].program;
+}
+
+bool ShaderBuilder::ready(int handle) const
+{
+	return handle >= 0 && handle < (int)jobs.size() && jobs[handle].done;
+}
+
+const ProgramReflection* ShaderBuilder::reflection(int handle) const
+{
+	if (program(handle) == 0)
+		return NULL;
+	return &jobs[handle].reflection;
+}
@@ -0,0 +1,90 @@
+#ifndef SHADER_BUILDER_H
+#define SHADER_BUILDER_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "program_reflection.h"
+
+// Compiles and links a batch of programs without waiting on each step.
+//
+// add() issues the compiles and the link straight away and returns; no
+// status is queried until the program is collected, so the driver is free
+// to work on everything submitted so far. With KHR_parallel_shader_compile
+// (or the ARB version) it does so on its own threads and poll() checks
+// GL_COMPLETION_STATUS_KHR, which never blocks. Without the extension
+// poll() collects a bounded number of programs per call, spreading the
+// wait over several frames, and finish() collects the rest.
+//
+// Identical sources added to one builder are compiled once and shared.
+// Programs belong to the caller once collected, destroy() leaves them alone.
+//
+// Every program that links is reflected as it is collected, so its
+// uniforms can be set by hashed name without asking the driver again.
+//
+// Collected programs can be warmed up with one draw that has rasterization
+// discarded, so drivers that finish compiling at the first draw do it here
+// instead of in the first frame that uses the program.
+class ShaderBuilder
+{
+public:
+	ShaderBuilder();
+
+	// Needs a current context with GL functions loaded
+	void init(bool warmUp = true);
+	void destroy();
+
+	// Start compiling and linking, returns the handle for program()
+	int add(const char* vertexSource, const char* fragmentSource);
+
+	// Collect finished programs without waiting; when the driver can't say
+	// whether a program is done, wait for at most maxBlocking of them.
+	// Returns the number still pending.
+	int poll(int maxBlocking = 1);
+
+	// Wait for everything, false if any program failed to build
+	bool finish();
+
+	// Wait for one program, returns it (0 if it failed)
+	unsigned int wait(int handle);
+
+	// 0 while pending or if the program failed
+	unsigned int program(int handle) const;
+	bool ready(int handle) const;
+
+	// Reflection of a collected program, NULL while pending or if it failed
+	const ProgramReflection* reflection(int handle) const;
+
+	int pendingCount() const { return pending; }
+	int failureCount() const { return failures; }
+	bool parallel() const { return parallelCompile; }
+
+private:
+	struct SharedShader
+	{
+		unsigned int name;
+		int users;
+	};
+	struct Job
+	{
+		unsigned int program;
+		std::string shaderKeys[2];
+		bool done;
+		ProgramReflection reflection;
+	};
+
+	std::string acquireShader(unsigned int type, const char* source);
+	void releaseShader(const std::string& key);
+	void collect(Job& job);
+	void warm(unsigned int program);
+
+	std::vector<Job> jobs;
+	std::map<std::string, SharedShader> shaders;
+	int pending;
+	int failures;
+	bool parallelCompile;
+	bool warmUp;
+	unsigned int warmVAO;
+};
+
+#endif
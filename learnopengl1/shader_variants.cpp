@@ -0,0 +1,286 @@
+#include "shader_variants.h"
+
+#include <cctype>
+#include <iostream>
+#include <glad/glad.h>
+
+static const int MAX_INCLUDE_DEPTH = 16;
+
+// FNV-1a; the terminating zero is hashed too, so where one text ends counts
+static unsigned long long hashText(unsigned long long hash, const std::string& text)
+{
+	const char* characters = text.c_str();
+	for (size_t i = 0; i <= text.size(); i++)
+	{
+		hash ^= (unsigned char)characters[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static bool isIdentifier(char c)
+{
+	return isalnum((unsigned char)c) || c == '_';
+}
+
+// Whether name appears in text as a whole identifier
+static bool mentions(const std::string& text, const std::string& name)
+{
+	for (size_t at = text.find(name); at != std::string::npos; at = text.find(name, at + 1))
+	{
+		bool startsToken = at == 0 || !isIdentifier(text[at - 1]);
+		bool endsToken = at + name.size() >= text.size() || !isIdentifier(text[at + name.size()]);
+		if (startsToken && endsToken)
+			return true;
+	}
+	return false;
+}
+
+// Splits "  #  ifdef  NAME  " into "ifdef" and "NAME", false for other lines
+static bool parseDirective(const std::string& line, std::string& directive, std::string& argument)
+{
+	size_t at = line.find_first_not_of(" \t");
+	if (at == std::string::npos || line[at] != '#')
+		return false;
+	at = line.find_first_not_of(" \t", at + 1);
+	if (at == std::string::npos)
+		return false;
+
+	size_t end = at;
+	while (end < line.size() && isIdentifier(line[end]))
+		end++;
+	directive = line.substr(at, end - at);
+
+	size_t argumentStart = line.find_first_not_of(" \t", end);
+	size_t argumentEnd = line.find_last_not_of(" \t\r");
+	argument = argumentStart == std::string::npos || argumentEnd < argumentStart ? ""
+		: line.substr(argumentStart, argumentEnd - argumentStart + 1);
+	return true;
+}
+
+ShaderVariants::ShaderVariants(const char* vertexSource, const char* fragmentSource)
+	: vertexSource(vertexSource), fragmentSource(fragmentSource)
+{
+}
+
+unsigned int ShaderVariants::addFeature(const char* name)
+{
+	if (features.size() >= 32)
+	{
+		std::cout << "ERROR::SHADER::VARIANTS::TOO_MANY_FEATURES " << name << std::endl;
+		return 0;
+	}
+	features.push_back(name);
+	return 1u << (features.size() - 1);
+}
+
+void ShaderVariants::addInclude(const char* name, const char* source)
+{
+	includes[name] = source;
+}
+
+bool ShaderVariants::expand(const std::string& text, unsigned int key, int depth, std::string& out) const
+{
+	if (depth > MAX_INCLUDE_DEPTH)
+	{
+		std::cout << "ERROR::SHADER::VARIANTS::INCLUDE_TOO_DEEP" << std::endl;
+		return false;
+	}
+
+	// Open conditionals; only those on features are resolved here, the
+	// others are tracked so their #else and #endif go to the compiler
+	struct Block
+	{
+		bool feature;
+		bool parentActive;
+		bool taken;
+	};
+	std::vector<Block> blocks;
+	bool active = true;
+
+	size_t position = 0;
+	while (position < text.size())
+	{
+		size_t lineEnd = text.find('\n', position);
+		if (lineEnd == std::string::npos)
+			lineEnd = text.size();
+		std::string line = text.substr(position, lineEnd - position);
+		position = lineEnd + 1;
+
+		std::string directive, argument;
+		if (parseDirective(line, directive, argument))
+		{
+			if (directive == "ifdef" || directive == "ifndef" || directive == "if")
+			{
+				int feature = -1;
+				for (size_t i = 0; i < features.size() && directive != "if"; i++)
+				{
+					if (features[i] == argument)
+						feature = (int)i;
+				}
+
+				Block block;
+				block.feature = feature >= 0;
+				block.parentActive = active;
+				block.taken = true;
+				if (block.feature)
+				{
+					block.taken = ((key >> feature) & 1) != (directive == "ifndef" ? 1u : 0u);
+					blocks.push_back(block);
+					active = active && block.taken;
+					continue;
+				}
+				blocks.push_back(block);
+			}
+			else if (directive == "else" && !blocks.empty() && blocks.back().feature)
+			{
+				blocks.back().taken = !blocks.back().taken;
+				active = blocks.back().parentActive && blocks.back().taken;
+				continue;
+			}
+			else if (directive == "endif" && !blocks.empty())
+			{
+				Block block = blocks.back();
+				blocks.pop_back();
+				if (block.feature)
+				{
+					active = block.parentActive;
+					continue;
+				}
+			}
+			else if (directive == "include")
+			{
+				if (!active)
+					continue;
+				std::string name = argument;
+				if (name.size() >= 2 && (name[0] == '"' || name[0] == '<'))
+					name = name.substr(1, name.size() - 2);
+				std::map<std::string, std::string>::const_iterator found = includes.find(name);
+				if (found == includes.end())
+				{
+					std::cout << "ERROR::SHADER::VARIANTS::INCLUDE_NOT_FOUND " << name << std::endl;
+					return false;
+				}
+				if (!expand(found->second, key, depth + 1, out))
+					return false;
+				continue;
+			}
+		}
+
+		if (active)
+		{
+			out += line;
+			out += '\n';
+		}
+	}
+	return true;
+}
+
+std::string ShaderVariants::source(unsigned int stage, unsigned int key) const
+{
+	std::string text;
+	if (!expand(stage == GL_VERTEX_SHADER ? vertexSource : fragmentSource, key, 0, text))
+		return std::string();
+
+	// Only features the code still refers to get a #define, so keys that
+	// differ in features this stage doesn't use give the same text
+	std::string defines;
+	for (size_t i = 0; i < features.size(); i++)
+	{
+		if ((key >> i) & 1 && mentions(text, features[i]))
+			defines += "#define " + features[i] + " 1\n";
+	}
+
+	size_t insertAt = 0;
+	if (text.compare(0, 8, "#version") == 0)
+	{
+		size_t lineEnd = text.find('\n');
+		insertAt = lineEnd == std::string::npos ? text.size() : lineEnd + 1;
+	}
+	text.insert(insertAt, defines);
+	return text;
+}
+
+void ShaderVariants::init(bool warmUp)
+{
+	builder.init(warmUp);
+}
+
+void ShaderVariants::destroy()
+{
+	builder.finish();
+	for (std::map<unsigned long long, Program>::iterator i = programs.begin(); i != programs.end(); ++i)
+	{
+		unsigned int name = i->second.name != 0 ? i->second.name : builder.program(i->second.handle);
+		if (name != 0)
+			glDeleteProgram(name);
+	}
+	builder.destroy();
+	programs.clear();
+	variants.clear();
+}
+
+ShaderVariants::Program& ShaderVariants::findProgram(unsigned int key)
+{
+	std::map<unsigned int, unsigned long long>::iterator variant = variants.find(key);
+	if (variant != variants.end())
+		return programs[variant->second];
+
+	std::string vertex = source(GL_VERTEX_SHADER, key);
+	std::string fragment = source(GL_FRAGMENT_SHADER, key);
+	unsigned long long hash = hashText(hashText(14695981039346656037ULL, vertex), fragment);
+	variants[key] = hash;
+
+	std::map<unsigned long long, Program>::iterator found = programs.find(hash);
+	if (found != programs.end())
+		return found->second;
+
+	Program program;
+	program.name = 0;
+	program.handle = vertex.empty() || fragment.empty() ? -1 : builder.add(vertex.c_str(), fragment.c_str());
+	return programs[hash] = program;
+}
+
+void ShaderVariants::prepare(unsigned int key)
+{
+	findProgram(key);
+}
+
+void ShaderVariants::poll()
+{
+	builder.poll();
+	for (std::map<unsigned long long, Program>::iterator i = programs.begin(); i != programs.end(); ++i)
+	{
+		Program& program = i->second;
+		if (program.name == 0 && builder.ready(program.handle))
+			program.name = builder.program(program.handle);
+	}
+}
+
+unsigned int ShaderVariants::program(unsigned int key)
+{
+	Program& program = findProgram(key);
+	if (program.name == 0 && program.handle >= 0)
+		program.name = builder.wait(program.handle);
+	return program.name;
+}
+
+bool ShaderVariants::ready(unsigned int key) const
+{
+	std::map<unsigned int, unsigned long long>::const_iterator variant = variants.find(key);
+	if (variant == variants.end())
+		return false;
+	const Program& program = programs.find(variant->second)->second;
+	return program.name != 0 || program.handle < 0 || builder.ready(program.handle);
+}
+
+const ProgramReflection* ShaderVariants::reflection(unsigned int key) const
+{
+	std::map<unsigned int, unsigned long long>::const_iterator variant = variants.find(key);
+	if (variant == variants.end())
+		return NULL;
+	const Program& program = programs.find(variant->second)->second;
+	if (program.name == 0)
+		return NULL;
+	return builder.reflection(program.handle);
+}
@@ -0,0 +1,85 @@
+#ifndef SHADER_VARIANTS_H
+#define SHADER_VARIANTS_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "shader_builder.h"
+
+// A family of programs specialized from one vertex and one fragment source.
+//
+// Features are #define switches; bit i of a key turns on the i-th feature
+// added. Specializing a stage for a key:
+//   - #include "name" is replaced by the include registered under that name
+//     (nested includes work, a missing one is an error);
+//   - #ifdef / #ifndef / #else / #endif on feature names are resolved right
+//     away, other preprocessor lines are left for the GLSL compiler;
+//   - "#define NAME 1" is added after #version for each enabled feature the
+//     remaining text still mentions.
+// Keys whose features don't change the resulting text share one program:
+// programs are deduplicated by a hash of the final sources.
+//
+// Programs are built on demand with program(), or ahead of time with
+// prepare() and poll(), which compile in the background where the driver
+// supports it. They belong to the variants and are deleted by destroy().
+class ShaderVariants
+{
+public:
+	ShaderVariants(const char* vertexSource, const char* fragmentSource);
+
+	// Returns the key bit of the feature (at most 32 features)
+	unsigned int addFeature(const char* name);
+	void addInclude(const char* name, const char* source);
+
+	// Final source of GL_VERTEX_SHADER or GL_FRAGMENT_SHADER for key,
+	// empty if an #include could not be resolved
+	std::string source(unsigned int stage, unsigned int key) const;
+
+	// Needs a current context with GL functions loaded; warmUp as for ShaderBuilder
+	void init(bool warmUp = true);
+	void destroy();
+
+	// Start building the program for key without waiting for it
+	void prepare(unsigned int key);
+
+	// Pick up programs that finished building (call once per frame)
+	void poll();
+
+	// Program for key, built now if it wasn't prepared; 0 on errors
+	unsigned int program(unsigned int key);
+
+	// Whether the program for a prepared key has finished building (or
+	// failed), so program() returns without waiting
+	bool ready(unsigned int key) const;
+
+	// Uniforms and blocks of the program for key, reflected when it was
+	// built; NULL until program() or poll() has it, or if it failed
+	const ProgramReflection* reflection(unsigned int key) const;
+
+	bool parallel() const { return builder.parallel(); }
+
+	// Keys asked for so far and the distinct programs they needed
+	int variantCount() const { return (int)variants.size(); }
+	int programCount() const { return (int)programs.size(); }
+
+private:
+	struct Program
+	{
+		int handle;
+		unsigned int name;
+	};
+
+	bool expand(const std::string& text, unsigned int key, int depth, std::string& out) const;
+	Program& findProgram(unsigned int key);
+
+	std::string vertexSource;
+	std::string fragmentSource;
+	std::vector<std::string> features;
+	std::map<std::string, std::string> includes;
+	// Key -> hash of its final sources -> program
+	std::map<unsigned int, unsigned long long> variants;
+	std::map<unsigned long long, Program> programs;
+	ShaderBuilder builder;
+};
+
+#endif
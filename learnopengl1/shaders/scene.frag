@@ -0,0 +1,16 @@
+// Fragment shader of the scene's SPIR-V path. The color is a set of
+// specialization constants, so one module serves both triangles.
+// CMake compiles it when glslangValidator is found:
+//   glslangValidator -G -o scene.frag.spv scene.frag
+#version 450 core
+
+layout (constant_id = 0) const float red = 1.0;
+layout (constant_id = 1) const float green = 0.5;
+layout (constant_id = 2) const float blue = 0.2;
+
+layout (location = 0) out vec4 FragColor;
+
+void main()
+{
+	FragColor = vec4(red, green, blue, 1.0);
+}
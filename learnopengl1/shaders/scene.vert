@@ -0,0 +1,11 @@
+// Vertex shader of the scene's SPIR-V path (same as the inline GLSL one).
+// CMake compiles it when glslangValidator is found:
+//   glslangValidator -G -o scene.vert.spv scene.vert
+#version 450 core
+
+layout (location = 0) in vec3 aPos;
+
+void main()
+{
+	gl_Position = vec4(aPos, 1.0);
+}
@@ -0,0 +1,65 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free queue for exactly one producer and one consumer thread.
+//
+// The producer only writes tail and the consumer only writes head, so
+// neither ever waits on the other: push() fails when the queue is full and
+// pop() when it is empty. The release store of an index publishes the slot
+// it covers to the other thread's acquire load. The indices sit on their
+// own cache lines so the two threads don't keep stealing one line.
+template <typename T>
+class SpscQueue
+{
+public:
+	// capacity is rounded up to a power of two
+	SpscQueue(size_t capacity = 256)
+		: head(0), tail(0)
+	{
+		size_t size = 2;
+		while (size < capacity)
+			size *= 2;
+		slots.resize(size);
+		mask = size - 1;
+	}
+
+	// Producer side
+	bool push(const T& value)
+	{
+		size_t back = tail.load(std::memory_order_relaxed);
+		if (back - head.load(std::memory_order_acquire) == slots.size())
+			return false;
+		slots[back & mask] = value;
+		tail.store(back + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side
+	bool pop(T& value)
+	{
+		size_t front = head.load(std::memory_order_relaxed);
+		if (front == tail.load(std::memory_order_acquire))
+			return false;
+		value = slots[front & mask];
+		head.store(front + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Only a hint while the other side is running
+	bool empty() const
+	{
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+	}
+
+private:
+	std::vector<T> slots;
+	size_t mask;
+	alignas(64) std::atomic<size_t> head;
+	alignas(64) std::atomic<size_t> tail;
+};
+
+#endif
@@ -0,0 +1,498 @@
+#include "state_cache.h"
+
+#include <cstring>
+#include "glad_ext.h"
+
+// Shadow value of a binding nothing is known about yet
+static const unsigned int UNKNOWN = 0xFFFFFFFFu;
+
+// Buffer targets whose binding is shadowed, others pass straight through
+static const GLenum bufferTargets[] = {
+	GL_ARRAY_BUFFER,
+	GL_ELEMENT_ARRAY_BUFFER,
+	GL_UNIFORM_BUFFER,
+	GL_SHADER_STORAGE_BUFFER,
+	GL_DRAW_INDIRECT_BUFFER,
+	GL_DISPATCH_INDIRECT_BUFFER,
+	GL_PARAMETER_BUFFER,
+	GL_ATOMIC_COUNTER_BUFFER,
+	GL_COPY_READ_BUFFER,
+	GL_COPY_WRITE_BUFFER,
+	GL_PIXEL_PACK_BUFFER,
+	GL_PIXEL_UNPACK_BUFFER,
+	GL_TEXTURE_BUFFER,
+	GL_TRANSFORM_FEEDBACK_BUFFER,
+	GL_QUERY_BUFFER
+};
+static const int BUFFER_TARGET_COUNT = sizeof(bufferTargets) / sizeof(bufferTargets[0]);
+static const int ELEMENT_ARRAY_SLOT = 1;
+
+static const GLenum textureTargets[] = {
+	GL_TEXTURE_1D,
+	GL_TEXTURE_2D,
+	GL_TEXTURE_3D,
+	GL_TEXTURE_CUBE_MAP,
+	GL_TEXTURE_1D_ARRAY,
+	GL_TEXTURE_2D_ARRAY,
+	GL_TEXTURE_RECTANGLE,
+	GL_TEXTURE_BUFFER,
+	GL_TEXTURE_CUBE_MAP_ARRAY,
+	GL_TEXTURE_2D_MULTISAMPLE,
+	GL_TEXTURE_2D_MULTISAMPLE_ARRAY
+};
+static const int TEXTURE_TARGET_COUNT = sizeof(textureTargets) / sizeof(textureTargets[0]);
+static const int TEXTURE_UNIT_COUNT = 32;
+
+static const GLenum capabilities[] = {
+	GL_BLEND,
+	GL_DEPTH_TEST,
+	GL_CULL_FACE,
+	GL_SCISSOR_TEST,
+	GL_STENCIL_TEST,
+	GL_POLYGON_OFFSET_FILL,
+	GL_MULTISAMPLE,
+	GL_SAMPLE_ALPHA_TO_COVERAGE,
+	GL_FRAMEBUFFER_SRGB,
+	GL_PRIMITIVE_RESTART,
+	GL_RASTERIZER_DISCARD,
+	GL_PROGRAM_POINT_SIZE,
+	GL_DEPTH_CLAMP
+};
+static const int CAPABILITY_COUNT = sizeof(capabilities) / sizeof(capabilities[0]);
+
+static int findSlot(const GLenum* targets, int count, GLenum target)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (targets[i] == target)
+			return i;
+	}
+	return -1;
+}
+
+// What the calling thread's context is believed to have bound and set
+struct ShadowState
+{
+	unsigned int program;
+	unsigned int vertexArray;
+	unsigned int buffers[BUFFER_TARGET_COUNT];
+	unsigned int activeUnit;
+	unsigned int textures[TEXTURE_UNIT_COUNT][TEXTURE_TARGET_COUNT];
+	// 1 enabled, 0 disabled, -1 unknown
+	signed char capabilities[CAPABILITY_COUNT];
+	bool blendFuncKnown;
+	GLenum blendFunc[4];
+	bool blendEquationKnown;
+	GLenum blendEquation[2];
+	bool depthFuncKnown;
+	GLenum depthFunc;
+	int depthMask;
+	bool viewportKnown;
+	int viewport[4];
+
+	StateCacheCounters counters;
+
+	ShadowState()
+	{
+		reset();
+		counters.issued = 0;
+		counters.filtered = 0;
+	}
+
+	void reset()
+	{
+		program = UNKNOWN;
+		vertexArray = UNKNOWN;
+		for (int i = 0; i < BUFFER_TARGET_COUNT; i++)
+			buffers[i] = UNKNOWN;
+		activeUnit = UNKNOWN;
+		for (int unit = 0; unit < TEXTURE_UNIT_COUNT; unit++)
+		{
+			for (int i = 0; i < TEXTURE_TARGET_COUNT; i++)
+				textures[unit][i] = UNKNOWN;
+		}
+		memset(capabilities, -1, sizeof(capabilities));
+		blendFuncKnown = false;
+		blendEquationKnown = false;
+		depthFuncKnown = false;
+		depthMask = -1;
+		viewportKnown = false;
+	}
+
+	// Count a call and say whether it has to reach the driver
+	bool issue(bool changed)
+	{
+		if (changed)
+			counters.issued++;
+		else
+			counters.filtered++;
+		return changed;
+	}
+};
+
+static thread_local ShadowState shadow;
+static bool installed = false;
+
+// Saved pointers the wrappers forward to
+static PFNGLUSEPROGRAMPROC realUseProgram;
+static PFNGLBINDVERTEXARRAYPROC realBindVertexArray;
+static PFNGLDELETEVERTEXARRAYSPROC realDeleteVertexArrays;
+static PFNGLBINDBUFFERPROC realBindBuffer;
+static PFNGLBINDBUFFERBASEPROC realBindBufferBase;
+static PFNGLBINDBUFFERRANGEPROC realBindBufferRange;
+static PFNGLDELETEBUFFERSPROC realDeleteBuffers;
+static PFNGLACTIVETEXTUREPROC realActiveTexture;
+static PFNGLBINDTEXTUREPROC realBindTexture;
+static PFNGLDELETETEXTURESPROC realDeleteTextures;
+static PFNGLENABLEPROC realEnable;
+static PFNGLDISABLEPROC realDisable;
+static PFNGLBLENDFUNCPROC realBlendFunc;
+static PFNGLBLENDFUNCSEPARATEPROC realBlendFuncSeparate;
+static PFNGLBLENDEQUATIONPROC realBlendEquation;
+static PFNGLBLENDEQUATIONSEPARATEPROC realBlendEquationSeparate;
+static PFNGLDEPTHFUNCPROC realDepthFunc;
+static PFNGLDEPTHMASKPROC realDepthMask;
+static PFNGLVIEWPORTPROC realViewport;
+
+static void APIENTRY cachedUseProgram(GLuint program)
+{
+	ShadowState& state = shadow;
+	if (state.issue(state.program != program))
+	{
+		realUseProgram(program);
+		state.program = program;
+	}
+}
+
+static void APIENTRY cachedBindVertexArray(GLuint array)
+{
+	ShadowState& state = shadow;
+	if (state.issue(state.vertexArray != array))
+	{
+		realBindVertexArray(array);
+		state.vertexArray = array;
+		// The element buffer binding lives in the vertex array
+		state.buffers[ELEMENT_ARRAY_SLOT] = UNKNOWN;
+	}
+}
+
+static void APIENTRY cachedDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+	// Deleting the bound array binds 0, and the name may come back later
+	ShadowState& state = shadow;
+	for (GLsizei i = 0; i < n; i++)
+	{
+		if (arrays[i] != 0 && arrays[i] == state.vertexArray)
+		{
+			state.vertexArray = 0;
+			state.buffers[ELEMENT_ARRAY_SLOT] = UNKNOWN;
+		}
+	}
+	realDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY cachedBindBuffer(GLenum target, GLuint buffer)
+{
+	ShadowState& state = shadow;
+	int slot = findSlot(bufferTargets, BUFFER_TARGET_COUNT, target);
+	if (slot < 0)
+	{
+		state.counters.issued++;
+		realBindBuffer(target, buffer);
+		return;
+	}
+	if (state.issue(state.buffers[slot] != buffer))
+	{
+		realBindBuffer(target, buffer);
+		state.buffers[slot] = buffer;
+	}
+}
+
+// Indexed binds always go through but also set the generic binding
+static void APIENTRY cachedBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	ShadowState& state = shadow;
+	int slot = findSlot(bufferTargets, BUFFER_TARGET_COUNT, target);
+	if (slot >= 0)
+		state.buffers[slot] = buffer;
+	state.counters.issued++;
+	realBindBufferBase(target, index, buffer);
+}
+
+static void APIENTRY cachedBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	ShadowState& state = shadow;
+	int slot = findSlot(bufferTargets, BUFFER_TARGET_COUNT, target);
+	if (slot >= 0)
+		state.buffers[slot] = buffer;
+	state.counters.issued++;
+	realBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void APIENTRY cachedDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+	ShadowState& state = shadow;
+	for (GLsizei i = 0; i < n; i++)
+	{
+		if (buffers[i] == 0)
+			continue;
+		for (int slot = 0; slot < BUFFER_TARGET_COUNT; slot++)
+		{
+			if (state.buffers[slot] == buffers[i])
+				state.buffers[slot] = 0;
+		}
+	}
+	realDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY cachedActiveTexture(GLenum texture)
+{
+	ShadowState& state = shadow;
+	unsigned int unit = texture - GL_TEXTURE0;
+	if (state.issue(state.activeUnit != unit))
+	{
+		realActiveTexture(texture);
+		state.activeUnit = unit;
+	}
+}
+
+static void APIENTRY cachedBindTexture(GLenum target, GLuint texture)
+{
+	ShadowState& state = shadow;
+	int slot = findSlot(textureTargets, TEXTURE_TARGET_COUNT, target);
+	if (slot < 0 || state.activeUnit >= (unsigned int)TEXTURE_UNIT_COUNT)
+	{
+		state.counters.issued++;
+		realBindTexture(target, texture);
+		return;
+	}
+	unsigned int& bound = state.textures[state.activeUnit][slot];
+	if (state.issue(bound != texture))
+	{
+		realBindTexture(target, texture);
+		bound = texture;
+	}
+}
+
+static void APIENTRY cachedDeleteTextures(GLsizei n, const GLuint* textures)
+{
+	// Deleted textures are unbound from every unit
+	ShadowState& state = shadow;
+	for (GLsizei i = 0; i < n; i++)
+	{
+		if (textures[i] == 0)
+			continue;
+		for (int unit = 0; unit < TEXTURE_UNIT_COUNT; unit++)
+		{
+			for (int slot = 0; slot < TEXTURE_TARGET_COUNT; slot++)
+			{
+				if (state.textures[unit][slot] == textures[i])
+					state.textures[unit][slot] = 0;
+			}
+		}
+	}
+	realDeleteTextures(n, textures);
+}
+
+static bool setCapability(GLenum cap, signed char value)
+{
+	ShadowState& state = shadow;
+	int slot = findSlot(capabilities, CAPABILITY_COUNT, cap);
+	if (slot < 0)
+	{
+		state.counters.issued++;
+		return true;
+	}
+	if (!state.issue(state.capabilities[slot] != value))
+		return false;
+	state.capabilities[slot] = value;
+	return true;
+}
+
+static void APIENTRY cachedEnable(GLenum cap)
+{
+	if (setCapability(cap, 1))
+		realEnable(cap);
+}
+
+static void APIENTRY cachedDisable(GLenum cap)
+{
+	if (setCapability(cap, 0))
+		realDisable(cap);
+}
+
+static bool setBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	ShadowState& state = shadow;
+	bool changed = !state.blendFuncKnown || state.blendFunc[0] != srcRGB || state.blendFunc[1] != dstRGB
+		|| state.blendFunc[2] != srcAlpha || state.blendFunc[3] != dstAlpha;
+	if (!state.issue(changed))
+		return false;
+	state.blendFuncKnown = true;
+	state.blendFunc[0] = srcRGB;
+	state.blendFunc[1] = dstRGB;
+	state.blendFunc[2] = srcAlpha;
+	state.blendFunc[3] = dstAlpha;
+	return true;
+}
+
+static void APIENTRY cachedBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	if (setBlendFunc(sfactor, dfactor, sfactor, dfactor))
+		realBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY cachedBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	if (setBlendFunc(srcRGB, dstRGB, srcAlpha, dstAlpha))
+		realBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static bool setBlendEquation(GLenum modeRGB, GLenum modeAlpha)
+{
+	ShadowState& state = shadow;
+	bool changed = !state.blendEquationKnown || state.blendEquation[0] != modeRGB || state.blendEquation[1] != modeAlpha;
+	if (!state.issue(changed))
+		return false;
+	state.blendEquationKnown = true;
+	state.blendEquation[0] = modeRGB;
+	state.blendEquation[1] = modeAlpha;
+	return true;
+}
+
+static void APIENTRY cachedBlendEquation(GLenum mode)
+{
+	if (setBlendEquation(mode, mode))
+		realBlendEquation(mode);
+}
+
+static void APIENTRY cachedBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+	if (setBlendEquation(modeRGB, modeAlpha))
+		realBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void APIENTRY cachedDepthFunc(GLenum func)
+{
+	ShadowState& state = shadow;
+	if (state.issue(!state.depthFuncKnown || state.depthFunc != func))
+	{
+		realDepthFunc(func);
+		state.depthFuncKnown = true;
+		state.depthFunc = func;
+	}
+}
+
+static void APIENTRY cachedDepthMask(GLboolean flag)
+{
+	ShadowState& state = shadow;
+	int value = flag ? 1 : 0;
+	if (state.issue(state.depthMask != value))
+	{
+		realDepthMask(flag);
+		state.depthMask = value;
+	}
+}
+
+static void APIENTRY cachedViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	ShadowState& state = shadow;
+	bool changed = !state.viewportKnown || state.viewport[0] != x || state.viewport[1] != y
+		|| state.viewport[2] != width || state.viewport[3] != height;
+	if (state.issue(changed))
+	{
+		realViewport(x, y, width, height);
+		state.viewportKnown = true;
+		state.viewport[0] = x;
+		state.viewport[1] = y;
+		state.viewport[2] = width;
+		state.viewport[3] = height;
+	}
+}
+
+// Swap a glad pointer for its wrapper (or back), keeping the original.
+// The current pointer is wrapped, so this stacks on top of a running capture.
+#define HOOK(name, type) real##name = (type)gladResolveGLProc("gl" #name); glad_gl##name = cached##name
+#define UNHOOK(name) glad_gl##name = real##name
+
+void enableStateCache()
+{
+	if (installed)
+		return;
+
+	HOOK(UseProgram, PFNGLUSEPROGRAMPROC);
+	HOOK(BindVertexArray, PFNGLBINDVERTEXARRAYPROC);
+	HOOK(DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
+	HOOK(BindBuffer, PFNGLBINDBUFFERPROC);
+	HOOK(DeleteBuffers, PFNGLDELETEBUFFERSPROC);
+	HOOK(ActiveTexture, PFNGLACTIVETEXTUREPROC);
+	HOOK(BindTexture, PFNGLBINDTEXTUREPROC);
+	HOOK(DeleteTextures, PFNGLDELETETEXTURESPROC);
+	HOOK(Enable, PFNGLENABLEPROC);
+	HOOK(Disable, PFNGLDISABLEPROC);
+	HOOK(BlendFunc, PFNGLBLENDFUNCPROC);
+	HOOK(BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC);
+	HOOK(BlendEquation, PFNGLBLENDEQUATIONPROC);
+	HOOK(BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC);
+	HOOK(DepthFunc, PFNGLDEPTHFUNCPROC);
+	HOOK(DepthMask, PFNGLDEPTHMASKPROC);
+	HOOK(Viewport, PFNGLVIEWPORTPROC);
+
+	// Indexed binds only exist from 3.0 on
+	realBindBufferBase = (PFNGLBINDBUFFERBASEPROC)gladResolveGLProc("glBindBufferBase");
+	if (realBindBufferBase != NULL)
+		glad_glBindBufferBase = cachedBindBufferBase;
+	realBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)gladResolveGLProc("glBindBufferRange");
+	if (realBindBufferRange != NULL)
+		glad_glBindBufferRange = cachedBindBufferRange;
+
+	invalidateStateCache();
+	installed = true;
+}
+
+void disableStateCache()
+{
+	if (!installed)
+		return;
+
+	UNHOOK(UseProgram);
+	UNHOOK(BindVertexArray);
+	UNHOOK(DeleteVertexArrays);
+	UNHOOK(BindBuffer);
+	UNHOOK(DeleteBuffers);
+	UNHOOK(ActiveTexture);
+	UNHOOK(BindTexture);
+	UNHOOK(DeleteTextures);
+	UNHOOK(Enable);
+	UNHOOK(Disable);
+	UNHOOK(BlendFunc);
+	UNHOOK(BlendFuncSeparate);
+	UNHOOK(BlendEquation);
+	UNHOOK(BlendEquationSeparate);
+	UNHOOK(DepthFunc);
+	UNHOOK(DepthMask);
+	UNHOOK(Viewport);
+	if (realBindBufferBase != NULL)
+		UNHOOK(BindBufferBase);
+	if (realBindBufferRange != NULL)
+		UNHOOK(BindBufferRange);
+	installed = false;
+}
+
+bool stateCacheEnabled()
+{
+	return installed;
+}
+
+void invalidateStateCache()
+{
+	shadow.reset();
+}
+
+StateCacheCounters stateCacheFrameEnd()
+{
+	StateCacheCounters counters = shadow.counters;
+	shadow.counters.issued = 0;
+	shadow.counters.filtered = 0;
+	return counters;
+}
@@ -0,0 +1,38 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+// Redundant state filter, installed at the glad dispatch layer like the
+// capture hooks, so every glFoo() call in the process goes through it.
+//
+// It shadows the bound program, vertex array, buffers (per target), textures
+// (per unit and target), the enable caps, blend and depth state and the
+// viewport, and drops calls that would set what is already set. Shadow
+// state starts out unknown, so the first call of each kind always reaches
+// the driver.
+//
+// The shadow is per thread, matching one current context per thread. Code
+// that changes state some other way (another library, multi-bind calls
+// like glBindTextures, a new context on the same thread) must call
+// invalidateStateCache() afterwards.
+
+struct StateCacheCounters
+{
+	// Hooked calls forwarded to the driver
+	unsigned long long issued;
+	// Hooked calls dropped because they changed nothing
+	unsigned long long filtered;
+};
+
+// GL must be loaded first. Install and remove from one thread while no other
+// thread renders; remove before stopping a capture started earlier.
+void enableStateCache();
+void disableStateCache();
+bool stateCacheEnabled();
+
+// Forget everything the calling thread's shadow knows
+void invalidateStateCache();
+
+// Counters of the calling thread since the last call, then reset them
+StateCacheCounters stateCacheFrameEnd();
+
+#endif
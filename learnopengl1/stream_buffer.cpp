@@ -0,0 +1,124 @@
+#include "stream_buffer.h"
+
+#include <glad/glad.h>
+#include "glad_ext.h"
+
+StreamBuffer::StreamBuffer(unsigned int target, size_t regionSize, int regionCount)
+	: target(target), size(regionSize), regionCount(regionCount > 0 ? regionCount : 1), name(0),
+	region(0), cursor(0), mappedBase(NULL), mappedRange(false), stallCount(0), fences(this->regionCount, NULL)
+{
+}
+
+bool StreamBuffer::init(bool allowPersistent)
+{
+	glGenBuffers(1, &name);
+	glBindBuffer(target, name);
+	region = 0;
+	cursor = 0;
+
+	if (allowPersistent && GLAD_GL_VERSION_4_4 && gladGLProc("glBufferStorage") != NULL)
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(target, size * regionCount, NULL, flags);
+		mappedBase = (unsigned char*)glMapBufferRange(target, 0, size * regionCount, flags);
+		if (mappedBase != NULL)
+			return true;
+
+		// Immutable storage can't be respecified, start over with a plain buffer
+		glDeleteBuffers(1, &name);
+		glGenBuffers(1, &name);
+		glBindBuffer(target, name);
+	}
+
+	glBufferData(target, size, NULL, GL_STREAM_DRAW);
+	return true;
+}
+
+void StreamBuffer::destroy()
+{
+	for (size_t i = 0; i < fences.size(); i++)
+	{
+		if (fences[i] != NULL)
+			glDeleteSync((GLsync)fences[i]);
+		fences[i] = NULL;
+	}
+
+	if (mappedBase != NULL)
+	{
+		glBindBuffer(target, name);
+		glUnmapBuffer(target);
+		mappedBase = NULL;
+	}
+	glDeleteBuffers(1, &name);
+	name = 0;
+}
+
+void StreamBuffer::nextRegion()
+{
+	if (mappedBase == NULL)
+	{
+		// Orphan: the driver hands out fresh storage while draws still
+		// reading the old one finish in the background
+		glBindBuffer(target, name);
+		glBufferData(target, size, NULL, GL_STREAM_DRAW);
+		cursor = 0;
+		return;
+	}
+
+	fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	region = (region + 1) % regionCount;
+	cursor = 0;
+
+	GLsync fence = (GLsync)fences[region];
+	if (fence == NULL)
+		return;
+
+	// Poll first; only if the GPU is really behind flush and block on it
+	GLenum result = glClientWaitSync(fence, 0, 0);
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		stallCount++;
+		do
+			result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		while (result == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(fence);
+	fences[region] = NULL;
+}
+
+void* StreamBuffer::map(size_t bytes, size_t alignment, size_t& offset)
+{
+	if (bytes > size)
+		return NULL;
+
+	size_t start = alignment > 1 ? (cursor + alignment - 1) / alignment * alignment : cursor;
+	if (start + bytes > size)
+	{
+		nextRegion();
+		start = 0;
+	}
+	cursor = start + bytes;
+
+	// Regions are a multiple of any alignment callers use, so aligning within
+	// the region aligns in the buffer too
+	offset = region * size + start;
+	if (mappedBase != NULL)
+		return mappedBase + offset;
+
+	// Nothing the GPU still reads is ever in this range, so skip the sync
+	glBindBuffer(target, name);
+	mappedRange = true;
+	return glMapBufferRange(target, start, bytes,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+void StreamBuffer::unmap()
+{
+	// Coherent persistent writes need nothing more
+	if (!mappedRange)
+		return;
+
+	glBindBuffer(target, name);
+	glUnmapBuffer(target);
+	mappedRange = false;
+}
@@ -0,0 +1,61 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+// Ring buffer for geometry rewritten every frame.
+//
+// With GL 4.4 the buffer is created with glBufferStorage and mapped once,
+// persistently and coherently, so writes go straight into memory the GPU
+// reads from. The ring is split into regions (three by default: one being
+// written, up to two still in flight). Writes fill a region front to back,
+// it gets a fence when the CPU moves on to the next one, and it is only
+// written again once that fence has signalled.
+//
+// Older contexts orphan the buffer instead of switching regions and write
+// through unsynchronised glMapBufferRange, which the driver keeps safe.
+class StreamBuffer
+{
+public:
+	// target is the binding point used for (re)specifying the buffer
+	StreamBuffer(unsigned int target, size_t regionSize, int regionCount = 3);
+
+	// Needs a current context with GL functions loaded
+	bool init(bool allowPersistent = true);
+	void destroy();
+
+	// Room for size bytes at an offset that is a multiple of alignment.
+	// Returns where to write and sets offset (from the buffer start) for
+	// attribute pointers and draws; NULL if size can never fit a region.
+	void* map(size_t size, size_t alignment, size_t& offset);
+
+	// Done writing what the last map returned
+	void unmap();
+
+	unsigned int buffer() const { return name; }
+	bool persistent() const { return mappedBase != NULL; }
+	size_t regionSize() const { return size; }
+
+	// Times a region was still in use by the GPU and the CPU had to wait
+	int stalls() const { return stallCount; }
+
+private:
+	void nextRegion();
+
+	unsigned int target;
+	size_t size;
+	int regionCount;
+	unsigned int name;
+
+	int region;
+	size_t cursor;
+	unsigned char* mappedBase;
+	bool mappedRange;
+	int stallCount;
+
+	// GLsync handles, one per region
+	std::vector<void*> fences;
+};
+
+#endif